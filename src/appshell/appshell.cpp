@@ -271,8 +271,12 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
 
     switch (task.type) {
-    case CommandLineController::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
+    case CommandLineController::ConvertType::Batch: {
+        int workersCount = task.params.value(CommandLineController::ParamKey::WorkersCount, 1).toInt();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, workersCount);
+    } break;
+    case CommandLineController::ConvertType::Server:
+        ret = converter()->serveJobs(stylePath, forceMode);
         break;
     case CommandLineController::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
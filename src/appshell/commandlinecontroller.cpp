@@ -54,10 +54,16 @@ void CommandLineController::parse(const QStringList& args)
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("jobs", "Use with '-j <file>', process the conversion jobs in N parallel processes", "N"));
+    m_parser.addOption(QCommandLineOption("converter-server",
+                                          "Keep running and process conversion jobs from stdin, one JSON object per line, "
+                                          "results are printed to stdout"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
     m_parser.addOption(QCommandLineOption({ "M", "midi-operations" }, "Specify MIDI import operations file", "file"));
+    m_parser.addOption(QCommandLineOption("skip-musicxml-validation",
+                                          "Use with '-o <file>' or '-j <file>', don't validate imported MusicXML files against the schema"));
     m_parser.addOption(QCommandLineOption({ "P", "export-score-parts" }, "Use with '-o <file>.pdf', export score and parts"));
     m_parser.addOption(QCommandLineOption({ "f", "force" },
                                           "Use with '-o <file>', ignore warnings reg. score being corrupted or from wrong version"));
@@ -144,6 +150,11 @@ void CommandLineController::apply()
         midiImportExportConfiguration()->setMidiImportOperationsFile(m_parser.value("M").toStdString());
     }
 
+    if (m_parser.isSet("skip-musicxml-validation")) {
+        //! NOTE Don't write to settings, just on current session
+        musicXmlConfiguration()->setMusicxmlImportValidation(false, false);
+    }
+
     if (m_parser.isSet("b")) {
         std::optional<int> val = intValue("b");
         if (val) {
@@ -197,6 +208,20 @@ void CommandLineController::apply()
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = m_parser.value("j");
+
+        if (m_parser.isSet("jobs")) {
+            std::optional<int> val = intValue("jobs");
+            if (val) {
+                m_converterTask.params[CommandLineController::ParamKey::WorkersCount] = val.value();
+            } else {
+                LOGE() << "Option: --jobs not recognized value: " << m_parser.value("jobs");
+            }
+        }
+    }
+
+    if (m_parser.isSet("converter-server")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::Server;
     }
 
     if (m_parser.isSet("score-media")) {
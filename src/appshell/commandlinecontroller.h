@@ -30,6 +30,7 @@
 #include "ui/iuiconfiguration.h"
 #include "importexport/imagesexport/iimagesexportconfiguration.h"
 #include "importexport/midi/imidiconfiguration.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
 #include "importexport/audioexport/iaudioexportconfiguration.h"
 #include "iappshellconfiguration.h"
 #include "internal/istartupscenario.h"
@@ -43,6 +44,7 @@ class CommandLineController
     INJECT(appshell, ui::IUiConfiguration, uiConfiguration)
     INJECT(appshell, iex::imagesexport::IImagesExportConfiguration, imagesExportConfiguration)
     INJECT(appshell, iex::midi::IMidiImportExportConfiguration, midiImportExportConfiguration)
+    INJECT(appshell, iex::musicxml::IMusicXmlConfiguration, musicXmlConfiguration)
     INJECT(appshell, iex::audioexport::IAudioExportConfiguration, audioExportConfiguration)
     INJECT(appshell, IAppShellConfiguration, configuration)
     INJECT(appshell, IStartupScenario, startupScenario)
@@ -55,6 +57,7 @@ public:
     enum class ConvertType {
         File,
         Batch,
+        Server,
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
@@ -69,7 +72,8 @@ public:
         StylePath,
         ScoreSource,
         ScoreTransposeOptions,
-        ForceMode
+        ForceMode,
+        WorkersCount
     };
 
     struct ConverterTask {
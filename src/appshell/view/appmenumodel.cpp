@@ -318,6 +318,9 @@ MenuItem AppMenuModel::diagnosticItem() const
 {
     MenuItemList systemItems {
         makeMenuItem("diagnostic-show-paths"),
+        makeSeparator(),
+        makeMenuItem("diagnostic-profiler-timeline-start"),
+        makeMenuItem("diagnostic-profiler-timeline-stop"),
     };
 
     MenuItemList accessibilityItems {
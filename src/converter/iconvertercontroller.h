@@ -34,7 +34,9 @@ public:
     virtual ~IConverterController() = default;
 
     virtual Ret fileConvert(const io::path& in, const io::path& out, const io::path& stylePath = io::path(), bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path& batchJobFile, const io::path& stylePath = io::path(), bool forceMode = false) = 0;
+    virtual Ret batchConvert(const io::path& batchJobFile, const io::path& stylePath = io::path(), bool forceMode = false,
+                             int workersCount = 1) = 0;
+    virtual Ret serveJobs(const io::path& stylePath = io::path(), bool forceMode = false) = 0;
     virtual Ret convertScoreParts(const io::path& in, const io::path& out, const io::path& stylePath = io::path(),
                                   bool forceMode = false) = 0;
 
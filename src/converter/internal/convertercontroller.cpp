@@ -21,12 +21,23 @@
  */
 #include "convertercontroller.h"
 
+#include <iostream>
+#include <memory>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QFile>
+#include <QProcess>
+#include <QTemporaryDir>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
 
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
 #include "log.h"
 #include "convertercodes.h"
 #include "stringutils.h"
@@ -39,7 +50,24 @@ using namespace mu::notation;
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 
-mu::Ret ConverterController::batchConvert(const io::path& batchJobFile, const io::path& stylePath, bool forceMode)
+static long peakMemoryKb()
+{
+#ifdef Q_OS_UNIX
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef Q_OS_MAC
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return -1;
+#endif
+}
+
+mu::Ret ConverterController::batchConvert(const io::path& batchJobFile, const io::path& stylePath, bool forceMode, int workersCount)
 {
     TRACEFUNC;
 
@@ -49,18 +77,240 @@ mu::Ret ConverterController::batchConvert(const io::path& batchJobFile, const io
         return batchJob.ret;
     }
 
+    if (workersCount > 1 && batchJob.val.size() > 1) {
+        return batchConvertInWorkers(batchJob.val, workersCount);
+    }
+
     Ret ret = make_ret(Ret::Code::Ok);
     for (const Job& job : batchJob.val) {
-        ret = fileConvert(job.in, job.out, stylePath, forceMode);
+        ret = convertJob(job, stylePath, forceMode);
         if (!ret) {
-            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
+            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+mu::Ret ConverterController::serveJobs(const io::path& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    //! NOTE One job per line on stdin, written like the items of a batch job file
+    //! and optionally with an "id". One result object per line on stdout.
+    //! Fonts, instrument templates and styles stay loaded from one job to the next
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+
+        QJsonParseError err;
+        QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+
+        QJsonObject result;
+        Ret ret = make_ret(Ret::Code::Ok);
+
+        if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+            ret = make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString());
+        } else {
+            QJsonObject obj = doc.object();
+            result["id"] = obj["id"];
+
+            Job job = parseJob(obj);
+            ret = isJobValid(job) ? convertJob(job, stylePath, forceMode) : make_ret(Err::BatchJobFileFailedParse);
+        }
+
+        result["success"] = ret.success();
+        if (!ret) {
+            result["error"] = ret.code();
+            result["text"] = QString::fromStdString(ret.text());
+        }
+        result["ms"] = timer.elapsed();
+        result["peakMemoryKb"] = static_cast<qint64>(peakMemoryKb());
+
+        std::cout << QJsonDocument(result).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::convertJob(const Job& job, const io::path& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    auto notationProject = notationCreator()->newProject();
+    IF_ASSERT_FAILED(notationProject) {
+        return make_ret(Err::UnknownError);
+    }
+
+    Ret ret = notationProject->load(job.in, stylePath, forceMode);
+    if (!ret) {
+        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << job.in;
+        return make_ret(Err::InFileFailedLoad);
+    }
+
+    LOGI() << "loaded in " << timer.restart() << " ms, in: " << job.in;
+
+    IMasterNotationPtr masterNotation = notationProject->masterNotation();
+
+    for (const io::path& out : job.out) {
+        ret = convertNotation(masterNotation->notation(), out);
+        if (!ret) {
+            LOGE() << "failed convert, err: " << ret.toString() << ", out: " << out;
+            return ret;
+        }
+
+        LOGI() << "converted in " << timer.restart() << " ms, out: " << out;
+    }
+
+    for (const PartsOut& partsOut : job.partsOut) {
+        for (IExcerptNotationPtr excerpt : masterNotation->excerpts().val) {
+            io::path out = partsOut.prefix + excerpt->title().toStdString() + partsOut.suffix;
+
+            ret = convertNotation(excerpt->notation(), out);
+            if (!ret) {
+                LOGE() << "failed convert, err: " << ret.toString() << ", out: " << out;
+                return ret;
+            }
+
+            LOGI() << "converted in " << timer.restart() << " ms, out: " << out;
+        }
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::convertNotation(INotationPtr notation, const io::path& out) const
+{
+    std::string suffix = io::suffix(out);
+    auto writer = writers()->writer(suffix);
+    if (!writer) {
+        return make_ret(Err::ConvertTypeUnknown);
+    }
+
+    if (isConvertPageByPage(suffix)) {
+        return convertPageByPage(writer, notation, out);
+    }
+
+    return convertFullNotation(writer, notation, out);
+}
+
+mu::Ret ConverterController::batchConvertInWorkers(const BatchJob& batchJob, int workersCount) const
+{
+    TRACEFUNC;
+
+    //! NOTE The engraving keeps global state (MScore statics, fonts, layout caches),
+    //! so the jobs are shared out between child processes rather than threads.
+    //! Every worker is this application running the batch mode on its part of the jobs
+    workersCount = std::min(workersCount, static_cast<int>(batchJob.size()));
+
+    std::vector<QJsonArray> workerJobs(workersCount);
+    size_t jobIndex = 0;
+    for (const Job& job : batchJob) {
+        QJsonArray out;
+        for (const io::path& path : job.out) {
+            out.append(path.toQString());
+        }
+
+        for (const PartsOut& partsOut : job.partsOut) {
+            out.append(QJsonArray { QString::fromStdString(partsOut.prefix), QString::fromStdString(partsOut.suffix) });
+        }
+
+        QJsonObject obj;
+        obj["in"] = job.in.toQString();
+        obj["out"] = out;
+        workerJobs[jobIndex++ % workersCount].append(obj);
+    }
+
+    QTemporaryDir jobsDir;
+    if (!jobsDir.isValid()) {
+        return make_ret(Err::BatchJobFileFailedOpen);
+    }
+
+    const QStringList arguments = workerArguments();
+
+    Ret ret = make_ret(Ret::Code::Ok);
+    std::vector<std::unique_ptr<QProcess> > workers;
+    for (int i = 0; i < workersCount; ++i) {
+        QString jobFilePath = jobsDir.filePath(QString("job-%1.json").arg(i));
+        QFile jobFile(jobFilePath);
+        if (!jobFile.open(QIODevice::WriteOnly)) {
+            ret = make_ret(Err::BatchJobFileFailedOpen);
             break;
         }
+
+        jobFile.write(QJsonDocument(workerJobs[i]).toJson());
+        jobFile.close();
+
+        auto worker = std::make_unique<QProcess>();
+        worker->setProcessChannelMode(QProcess::ForwardedChannels);
+        worker->start(QCoreApplication::applicationFilePath(), arguments + QStringList { "-j", jobFilePath });
+
+        //! NOTE The jobs of a worker that did not start are not converted at all,
+        //! so the batch fails; the workers already running are still waited for below
+        if (!worker->waitForStarted(-1)) {
+            LOGE() << "failed start batch worker: " << i << ", err: " << worker->errorString();
+            ret = make_ret(Err::BatchJobWorkerFailedStart, worker->errorString().toStdString());
+            break;
+        }
+
+        workers.push_back(std::move(worker));
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (size_t i = 0; i < workers.size(); ++i) {
+        QProcess* worker = workers[i].get();
+        worker->waitForFinished(-1);
+
+        if (worker->error() != QProcess::UnknownError) {
+            LOGE() << "failed batch worker: " << i << ", err: " << worker->errorString();
+            ret = make_ret(Err::BatchJobWorkerFailed, worker->errorString().toStdString());
+        } else if (worker->exitStatus() != QProcess::NormalExit || worker->exitCode() != 0) {
+            LOGE() << "failed batch worker: " << i << ", exit code: " << worker->exitCode();
+            ret = make_ret(Err::BatchJobWorkerFailed);
+        }
     }
 
+    LOGI() << "converted " << batchJob.size() << " jobs with " << workersCount << " workers in " << timer.elapsed() << " ms";
+
     return ret;
 }
 
+QStringList ConverterController::workerArguments() const
+{
+    //! NOTE Workers get the same options as this process (resolution, trim, style...),
+    //! except for the job file and the workers count
+    QStringList arguments = QCoreApplication::arguments().mid(1);
+    QStringList result;
+
+    for (int i = 0; i < arguments.size(); ++i) {
+        const QString& arg = arguments.at(i);
+
+        if (arg == "-j" || arg == "--job" || arg == "--jobs") {
+            ++i; // skip the value
+            continue;
+        }
+
+        if (arg.startsWith("--job=") || arg.startsWith("--jobs=")) {
+            continue;
+        }
+
+        result << arg;
+    }
+
+    return result;
+}
+
 mu::Ret ConverterController::fileConvert(const io::path& in, const io::path& out, const io::path& stylePath, bool forceMode)
 {
     TRACEFUNC;
@@ -147,13 +397,8 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     QJsonArray arr = doc.array();
 
     for (const QJsonValue v : arr) {
-        QJsonObject obj = v.toObject();
-
-        Job job;
-        job.in = obj["in"].toString();
-        job.out = obj["out"].toString();
-
-        if (!job.in.empty() && !job.out.empty()) {
+        Job job = parseJob(v.toObject());
+        if (isJobValid(job)) {
             rv.val.push_back(std::move(job));
         }
     }
@@ -162,6 +407,35 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     return rv;
 }
 
+ConverterController::Job ConverterController::parseJob(const QJsonObject& obj) const
+{
+    Job job;
+    job.in = obj["in"].toString();
+
+    QJsonValue out = obj["out"];
+    if (out.isArray()) {
+        for (const QJsonValue o : out.toArray()) {
+            if (o.isArray()) {
+                QJsonArray parts = o.toArray();
+                if (parts.size() == 2) {
+                    job.partsOut.push_back({ parts.at(0).toString().toStdString(), parts.at(1).toString().toStdString() });
+                }
+            } else if (!o.toString().isEmpty()) {
+                job.out.push_back(o.toString());
+            }
+        }
+    } else if (!out.toString().isEmpty()) {
+        job.out.push_back(out.toString());
+    }
+
+    return job;
+}
+
+bool ConverterController::isJobValid(const Job& job) const
+{
+    return !job.in.empty() && (!job.out.empty() || !job.partsOut.empty());
+}
+
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     QList<std::string> types {
@@ -23,6 +23,10 @@
 #define MU_CONVERTER_CONVERTERCONTROLLER_H
 
 #include <list>
+#include <vector>
+
+#include <QJsonObject>
+#include <QStringList>
 
 #include "../iconvertercontroller.h"
 
@@ -42,7 +46,9 @@ public:
     ConverterController() = default;
 
     Ret fileConvert(const io::path& in, const io::path& out, const io::path& stylePath = io::path(), bool forceMode = false) override;
-    Ret batchConvert(const io::path& batchJobFile, const io::path& stylePath = io::path(), bool forceMode = false) override;
+    Ret batchConvert(const io::path& batchJobFile, const io::path& stylePath = io::path(), bool forceMode = false,
+                     int workersCount = 1) override;
+    Ret serveJobs(const io::path& stylePath = io::path(), bool forceMode = false) override;
     Ret convertScoreParts(const io::path& in, const io::path& out, const io::path& stylePath = io::path(), bool forceMode = false) override;
 
     Ret exportScoreMedia(const io::path& in, const io::path& out,
@@ -59,14 +65,29 @@ public:
 
 private:
 
+    //! NOTE A job has one or more outputs, the input is loaded and laid out once for all of them.
+    //! In the batch file `out` is either a path or a list, where a list item is either a path
+    //! or a [prefix, suffix] pair, meaning all parts written to prefix + part title + suffix
+    struct PartsOut {
+        std::string prefix;
+        std::string suffix;
+    };
+
     struct Job {
         io::path in;
-        io::path out;
+        std::vector<io::path> out;
+        std::vector<PartsOut> partsOut;
     };
 
     using BatchJob = std::list<Job>;
 
     RetVal<BatchJob> parseBatchJob(const io::path& batchJobFile) const;
+    Job parseJob(const QJsonObject& obj) const;
+    bool isJobValid(const Job& job) const;
+    Ret batchConvertInWorkers(const BatchJob& batchJob, int workersCount) const;
+    Ret convertJob(const Job& job, const io::path& stylePath, bool forceMode);
+    Ret convertNotation(notation::INotationPtr notation, const io::path& out) const;
+    QStringList workerArguments() const;
 
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path& out) const;
@@ -47,6 +47,14 @@ const UiActionList DiagnosticsActions::m_actions = {
     UiAction("diagnostic-show-engraving-elements",
              mu::context::UiCtxAny,
              QT_TRANSLATE_NOOP("action", "Engraving elements")
+             ),
+    UiAction("diagnostic-profiler-timeline-start",
+             mu::context::UiCtxAny,
+             QT_TRANSLATE_NOOP("action", "Start timeline capture")
+             ),
+    UiAction("diagnostic-profiler-timeline-stop",
+             mu::context::UiCtxAny,
+             QT_TRANSLATE_NOOP("action", "Stop timeline capture…")
              )
 };
 
@@ -22,6 +22,8 @@
 #include "diagnosticsactionscontroller.h"
 
 #include "uri.h"
+#include "log.h"
+#include "translation.h"
 
 #include "view/diagnosticaccessiblemodel.h"
 
@@ -40,6 +42,8 @@ void DiagnosticsActionsController::init()
     dispatcher()->reg(this, "diagnostic-show-accessible-tree", [this]() { openUri(ACCESSIBLE_TREE_URI); });
     dispatcher()->reg(this, "diagnostic-accessible-tree-dump", []() { DiagnosticAccessibleModel::dumpTree(); });
     dispatcher()->reg(this, "diagnostic-show-engraving-elements", [this]() { openUri(ENGRAVING_ELEMENTS_URI, false); });
+    dispatcher()->reg(this, "diagnostic-profiler-timeline-start", this, &DiagnosticsActionsController::startProfilerTimeline);
+    dispatcher()->reg(this, "diagnostic-profiler-timeline-stop", this, &DiagnosticsActionsController::stopProfilerTimeline);
 }
 
 void DiagnosticsActionsController::openUri(const mu::UriQuery& uri, bool isSingle)
@@ -50,3 +54,34 @@ void DiagnosticsActionsController::openUri(const mu::UriQuery& uri, bool isSingl
 
     interactive()->open(uri);
 }
+
+void DiagnosticsActionsController::startProfilerTimeline()
+{
+    LOGI() << "profiler timeline capture started";
+    haw::profiler::Profiler::instance()->startTimeline();
+}
+
+void DiagnosticsActionsController::stopProfilerTimeline()
+{
+    using namespace haw::profiler;
+
+    if (!Profiler::isTimelineActive()) {
+        return;
+    }
+
+    Profiler::instance()->stopTimeline();
+    LOGI() << "profiler timeline capture stopped";
+
+    QString filter = qtrc("diagnostics", "Trace events") + " (*.json)";
+    io::path path = interactive()->selectSavingFile(qtrc("diagnostics", "Save timeline"), io::path(), filter);
+    if (path.empty()) {
+        return;
+    }
+
+    if (!Profiler::instance()->saveTimeline(path.toStdString())) {
+        LOGE() << "failed save profiler timeline: " << path;
+        return;
+    }
+
+    LOGI() << "profiler timeline saved: " << path << " (open with chrome://tracing or https://ui.perfetto.dev)";
+}
@@ -41,6 +41,9 @@ public:
 
 private:
     void openUri(const mu::UriQuery& uri, bool isSingle = true);
+
+    void startProfilerTimeline();
+    void stopProfilerTimeline();
 };
 }
 
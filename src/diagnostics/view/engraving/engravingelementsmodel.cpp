@@ -26,6 +26,7 @@
 #include "engraving/libmscore/engravingobject.h"
 #include "engraving/libmscore/score.h"
 #include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/undo.h"
 #include "dataformatter.h"
 
 #include "log.h"
@@ -347,8 +348,22 @@ void EngravingElementsModel::updateInfo()
 {
     const EngravingObjectList& elements = elementsProvider()->elements();
     QHash<QString, int> els;
+    int undoMacros = 0;
+    int undoDropped = 0;
+    size_t undoCommands = 0;
+    size_t undoBytes = 0;
     for (const Ms::EngravingObject* el : elements) {
         els[el->name()] += 1;
+
+        if (el->isScore() && Ms::toScore(el)->isMaster()) {
+            const Ms::UndoStack* undo = Ms::toScore(el)->undoStack();
+            if (undo) {
+                undoMacros += undo->macroCount();
+                undoDropped += undo->droppedMacroCount();
+                undoCommands += undo->commandCount();
+                undoBytes += undo->estimatedMemoryUsage();
+            }
+        }
     }
 
     {
@@ -363,6 +378,8 @@ void EngravingElementsModel::updateInfo()
         m_summary.clear();
         QTextStream stream(&m_summary);
         stream << "Total: " << elements.size();
+        stream << ", undo steps: " << undoMacros << " (commands: " << undoCommands << ", dropped: " << undoDropped
+               << ", ~" << (undoBytes / 1024) << " kB)";
     }
 
     emit infoChanged();
@@ -39,7 +39,9 @@ AccessibleItem::AccessibleItem(Ms::EngravingItem* e)
 
 AccessibleItem::~AccessibleItem()
 {
-    AccessibleRoot* root = accessibleRoot();
+    //! NOTE Don't create the root accessible object just to unregister this one
+    Ms::Score* score = m_element ? m_element->score() : nullptr;
+    AccessibleRoot* root = (score && score->rootItem()->hasAccessible()) ? accessibleRoot() : nullptr;
 
     if (!root) {
         return;
@@ -62,6 +64,11 @@ AccessibleItem* AccessibleItem::clone(Ms::EngravingItem* e) const
     return new AccessibleItem(e);
 }
 
+bool AccessibleItem::isActive()
+{
+    return AccessibleItem::enabled && accessibilityController() && accessibilityController()->isActive();
+}
+
 void AccessibleItem::setup()
 {
     if (!AccessibleItem::enabled) {
@@ -72,6 +72,9 @@ public:
 
     static bool enabled;
 
+    //! NOTE Accessible objects of the engraving items are only created when this is true
+    static bool isActive();
+
 protected:
 
     Ms::EngravingItem* m_element = nullptr;
@@ -143,12 +143,12 @@ Err EngravingProject::loadMscz(const MscReader& msc, bool ignoreVersionError)
 
 bool EngravingProject::writeMscz(mu::engraving::MscWriter& writer, bool onlySelection, bool createThumbnail)
 {
-    bool ok = m_masterScore->writeMscz(writer, onlySelection, createThumbnail);
-    if (ok && !onlySelection) {
-        m_masterScore->undoStack()->setClean();
-        m_masterScore->setSaved(true);
-        m_masterScore->update();
-    }
+    return m_masterScore->writeMscz(writer, onlySelection, createThumbnail);
+}
 
-    return ok;
+void EngravingProject::markAsSaved()
+{
+    m_masterScore->undoStack()->setClean();
+    m_masterScore->setSaved(true);
+    m_masterScore->update();
 }
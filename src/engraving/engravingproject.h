@@ -71,6 +71,9 @@ public:
     Err loadMscz(const mu::engraving::MscReader& msc, bool ignoreVersionError);
     bool writeMscz(mu::engraving::MscWriter& writer, bool onlySelection, bool createThumbnail);
 
+    //! NOTE Marks the score as saved, to be called once the written project is on disk
+    void markAsSaved();
+
     void checkTree();
 
 private:
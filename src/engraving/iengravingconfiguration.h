@@ -65,6 +65,13 @@ public:
     virtual async::Notification scoreInversionChanged() const = 0;
 
     virtual draw::Color highlightSelectionColor(int voiceIndex = 0) const = 0;
+
+    //! NOTE Maximum number of undo steps kept per score (DEFAULT_UNDO_DEPTH by default), 0 means unlimited
+    virtual int undoHistoryMaxDepth() const = 0;
+    virtual void setUndoHistoryMaxDepth(int depth) = 0;
+
+    virtual bool isIncrementalSaveEnabled() const = 0;
+    virtual void setIncrementalSaveEnabled(bool enabled) = 0;
 };
 }
 
@@ -37,6 +37,9 @@ static const Settings::Key PART_STYLE_FILE_PATH("engraving", "engraving/style/pa
 
 static const Settings::Key INVERT_SCORE_COLOR("engraving", "engraving/scoreColorInversion");
 
+static const Settings::Key UNDO_HISTORY_MAX_DEPTH("engraving", "engraving/undo/maxDepth");
+static const Settings::Key INCREMENTAL_SAVE_ENABLED("engraving", "engraving/save/incremental");
+
 struct VoiceColorKey {
     Settings::Key key;
     Color color;
@@ -58,6 +61,12 @@ void EngravingConfiguration::init()
         m_scoreInversionChanged.notify();
     });
 
+    settings()->setDefaultValue(UNDO_HISTORY_MAX_DEPTH, Val(Ms::DEFAULT_UNDO_DEPTH));
+    settings()->setCanBeMannualyEdited(UNDO_HISTORY_MAX_DEPTH, true);
+
+    settings()->setDefaultValue(INCREMENTAL_SAVE_ENABLED, Val(false));
+    settings()->setCanBeMannualyEdited(INCREMENTAL_SAVE_ENABLED, true);
+
     for (int voice = 0; voice < Ms::VOICES; ++voice) {
         Settings::Key key("engraving", "engraving/colors/voice" + std::to_string(voice + 1));
 
@@ -168,3 +177,23 @@ async::Notification EngravingConfiguration::scoreInversionChanged() const
 {
     return m_scoreInversionChanged;
 }
+
+int EngravingConfiguration::undoHistoryMaxDepth() const
+{
+    return settings()->value(UNDO_HISTORY_MAX_DEPTH).toInt();
+}
+
+void EngravingConfiguration::setUndoHistoryMaxDepth(int depth)
+{
+    settings()->setSharedValue(UNDO_HISTORY_MAX_DEPTH, Val(depth));
+}
+
+bool EngravingConfiguration::isIncrementalSaveEnabled() const
+{
+    return settings()->value(INCREMENTAL_SAVE_ENABLED).toBool();
+}
+
+void EngravingConfiguration::setIncrementalSaveEnabled(bool enabled)
+{
+    settings()->setSharedValue(INCREMENTAL_SAVE_ENABLED, Val(enabled));
+}
@@ -60,6 +60,12 @@ public:
 
     async::Notification scoreInversionChanged() const override;
 
+    int undoHistoryMaxDepth() const override;
+    void setUndoHistoryMaxDepth(int depth) override;
+
+    bool isIncrementalSaveEnabled() const override;
+    void setIncrementalSaveEnabled(bool enabled) override;
+
 private:
     async::Channel<int, draw::Color> m_voiceColorChanged;
     async::Notification m_scoreInversionChanged;
@@ -102,6 +102,10 @@ MscWriter::IWriter* MscWriter::writer() const
             UNREACHABLE;
             break;
         }
+
+        if (m_writer && m_params.deferred) {
+            m_writer = new DeferredWriter(m_writer);
+        }
     }
 
     return m_writer;
@@ -342,6 +346,59 @@ bool MscWriter::DirWriter::addFileData(const QString& fileName, const QByteArray
     return true;
 }
 
+MscWriter::DeferredWriter::DeferredWriter(IWriter* writer)
+    : m_writer(writer)
+{
+}
+
+MscWriter::DeferredWriter::~DeferredWriter()
+{
+    delete m_writer;
+}
+
+bool MscWriter::DeferredWriter::open(QIODevice* device, const QString& filePath)
+{
+    m_device = device;
+    m_filePath = filePath;
+    m_isOpened = true;
+    return true;
+}
+
+void MscWriter::DeferredWriter::close()
+{
+    if (!m_isOpened) {
+        return;
+    }
+
+    m_isOpened = false;
+
+    if (!m_writer->open(m_device, m_filePath)) {
+        return;
+    }
+
+    for (const auto& file : m_files) {
+        m_writer->addFileData(file.first, file.second);
+    }
+
+    m_files.clear();
+    m_writer->close();
+}
+
+bool MscWriter::DeferredWriter::isOpened() const
+{
+    return m_isOpened;
+}
+
+bool MscWriter::DeferredWriter::addFileData(const QString& fileName, const QByteArray& data)
+{
+    IF_ASSERT_FAILED(m_isOpened) {
+        return false;
+    }
+
+    m_files.push_back({ fileName, data });
+    return true;
+}
+
 MscWriter::XmlFileWriter::~XmlFileWriter()
 {
     delete m_stream;
@@ -22,6 +22,9 @@
 #ifndef MU_ENGRAVING_MSCWRITER_H
 #define MU_ENGRAVING_MSCWRITER_H
 
+#include <vector>
+#include <utility>
+
 #include <QString>
 #include <QByteArray>
 #include <QIODevice>
@@ -41,6 +44,10 @@ public:
         QIODevice* device = nullptr;
         QString filePath;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE If deferred, the files are only collected in memory until close,
+        //! which then compresses and writes them, so it may be called on another thread
+        bool deferred = false;
     };
 
     MscWriter() = default;
@@ -112,6 +119,22 @@ private:
         QTextStream* m_stream = nullptr;
     };
 
+    struct DeferredWriter : public IWriter
+    {
+        DeferredWriter(IWriter* writer);
+        ~DeferredWriter() override;
+        bool open(QIODevice* device, const QString& filePath) override;
+        void close() override;
+        bool isOpened() const override;
+        bool addFileData(const QString& fileName, const QByteArray& data) override;
+    private:
+        IWriter* m_writer = nullptr;
+        QIODevice* m_device = nullptr;
+        QString m_filePath;
+        bool m_isOpened = false;
+        std::vector<std::pair<QString, QByteArray> > m_files;
+    };
+
     struct Meta {
         std::vector<QString> files;
         bool isWrited = false;
@@ -74,6 +74,11 @@ class LinksIndexer
 
 public:
     int assignLocalIndex(const Location& mainElementInfo);
+
+    bool operator==(const LinksIndexer& other) const
+    {
+        return _lastLocalIndex == other._lastLocalIndex && _lastLinkedElementLoc == other._lastLinkedElementLoc;
+    }
 };
 
 //---------------------------------------------------------
@@ -260,6 +265,9 @@ class XmlWriter : public QTextStream
     std::vector<std::pair<const EngravingObject*, QString> > _elements;
     bool _recordElements = false;
 
+    mutable std::vector<std::pair<int, int> >* _readLidLocalIndices = nullptr;
+    std::vector<std::pair<int, int> >* _writtenLidLocalIndices = nullptr;
+
     void putLevel();
 
 public:
@@ -292,11 +300,40 @@ public:
     void setWritePosition(bool v) { _writePosition = v; }
 
     int assignLocalIndex(const Location& mainElementLocation);
-    void setLidLocalIndex(int lid, int localIndex) { _lidLocalIndices.insert(lid, localIndex); }
-    int lidLocalIndex(int lid) const { return _lidLocalIndices[lid]; }
+    void setLidLocalIndex(int lid, int localIndex);
+    int lidLocalIndex(int lid) const;
+
+    //---------------------------------------------------------
+    //   State
+    //    the part of the writer state the output of
+    //    a measure depends on, see MeasureWriteCache
+    //---------------------------------------------------------
+
+    struct State {
+        Fraction curTick;
+        Fraction tickDiff;
+        int curTrack = -1;
+        int trackDiff = 0;
+        bool excerptmode = false;
+        bool msczMode = true;
+        bool writeTrack = false;
+        bool writePosition = false;
+        int level = 0;
+        LinksIndexer linksIndexer;
+
+        bool operator==(const State& other) const;
+        bool operator!=(const State& other) const { return !(*this == other); }
+    };
+
+    State state() const;
+    void setState(const State& state);
+
+    //! NOTE While set, all reads and writes of link local indices are appended to the lists
+    void setLidLocalIndicesRecorders(std::vector<std::pair<int, int> >* read, std::vector<std::pair<int, int> >* written);
 
     const std::vector<std::pair<const EngravingObject*, QString> >& elements() const { return _elements; }
     void setRecordElements(bool record) { _recordElements = record; }
+    bool recordElements() const { return _recordElements; }
 
     void sTag(const char* name, Spatium sp) { XmlWriter::tag(name, QVariant(sp.val())); }
     void pTag(const char* name, PlaceText);
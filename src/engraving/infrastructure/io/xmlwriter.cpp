@@ -438,6 +438,88 @@ int XmlWriter::assignLocalIndex(const Location& mainElementLocation)
     return _linksIndexer.assignLocalIndex(mainElementLocation);
 }
 
+//---------------------------------------------------------
+//   setLidLocalIndex
+//---------------------------------------------------------
+
+void XmlWriter::setLidLocalIndex(int lid, int localIndex)
+{
+    _lidLocalIndices.insert(lid, localIndex);
+    if (_writtenLidLocalIndices) {
+        _writtenLidLocalIndices->emplace_back(lid, localIndex);
+    }
+}
+
+//---------------------------------------------------------
+//   lidLocalIndex
+//---------------------------------------------------------
+
+int XmlWriter::lidLocalIndex(int lid) const
+{
+    const int localIndex = _lidLocalIndices.value(lid);
+    if (_readLidLocalIndices) {
+        _readLidLocalIndices->emplace_back(lid, localIndex);
+    }
+    return localIndex;
+}
+
+void XmlWriter::setLidLocalIndicesRecorders(std::vector<std::pair<int, int> >* read, std::vector<std::pair<int, int> >* written)
+{
+    _readLidLocalIndices = read;
+    _writtenLidLocalIndices = written;
+}
+
+//---------------------------------------------------------
+//   State
+//---------------------------------------------------------
+
+bool XmlWriter::State::operator==(const State& other) const
+{
+    return curTick == other.curTick
+           && tickDiff == other.tickDiff
+           && curTrack == other.curTrack
+           && trackDiff == other.trackDiff
+           && excerptmode == other.excerptmode
+           && msczMode == other.msczMode
+           && writeTrack == other.writeTrack
+           && writePosition == other.writePosition
+           && level == other.level
+           && linksIndexer == other.linksIndexer;
+}
+
+XmlWriter::State XmlWriter::state() const
+{
+    State st;
+    st.curTick = _curTick;
+    st.tickDiff = _tickDiff;
+    st.curTrack = _curTrack;
+    st.trackDiff = _trackDiff;
+    st.excerptmode = _excerptmode;
+    st.msczMode = _msczMode;
+    st.writeTrack = _writeTrack;
+    st.writePosition = _writePosition;
+    st.level = stack.size();
+    st.linksIndexer = _linksIndexer;
+    return st;
+}
+
+void XmlWriter::setState(const State& st)
+{
+    IF_ASSERT_FAILED(st.level == stack.size()) {
+        return;
+    }
+
+    _curTick = st.curTick;
+    _tickDiff = st.tickDiff;
+    _curTrack = st.curTrack;
+    _trackDiff = st.trackDiff;
+    _excerptmode = st.excerptmode;
+    _msczMode = st.msczMode;
+    _writeTrack = st.writeTrack;
+    _writePosition = st.writePosition;
+    _linksIndexer = st.linksIndexer;
+}
+
 //---------------------------------------------------------
 //   canWrite
 //---------------------------------------------------------
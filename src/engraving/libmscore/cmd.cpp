@@ -340,6 +340,17 @@ void Score::update(bool resetCmdState)
         MasterScore* ms = masterScore();
         CmdState& cs = ms->cmdState();
         ms->deletePostponed();
+
+        //! NOTE The undo commands drop the measures they change from the write cache,
+        //! the layout range also covers what the command changed indirectly
+        for (Score* s : ms->scoreList()) {
+            if (cs._instrumentsChanged || cs._excerptsChanged) {
+                s->invalidateMeasureWriteCache();
+            } else if (cs.layoutRange()) {
+                s->invalidateMeasureWriteCache(cs.startTick(), cs.endTick());
+            }
+        }
+
         if (cs.layoutRange()) {
             for (Score* s : ms->scoreList()) {
                 s->doLayoutRange(cs.startTick(), cs.endTick());
@@ -4251,7 +4262,7 @@ void Score::cmdToggleVisible()
         if (e->isBracket()) {       // ignore
             continue;
         }
-        if (e->isNoteDot() && selection().elements().contains(e->parentItem())) {
+        if (e->isNoteDot() && selection().contains(e->parentItem())) {
             // already handled in ScoreElement::undoChangeProperty(); don't toggle twice
             continue;
         }
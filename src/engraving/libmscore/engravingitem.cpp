@@ -186,11 +186,8 @@ void EngravingItem::setup()
         ElementType::LEDGER_LINE
     };
 
-    if (score() && !score()->isPaletteScore()) {
-        if (std::find(accessibleDisabled.begin(), accessibleDisabled.end(), type()) == accessibleDisabled.end()) {
-            m_accessible = createAccessible();
-            m_accessible->setup();
-        }
+    if (score() && !score()->isPaletteScore() && mu::engraving::AccessibleItem::enabled) {
+        m_accessibleEnabled = std::find(accessibleDisabled.begin(), accessibleDisabled.end(), type()) == accessibleDisabled.end();
     }
 }
 
@@ -1866,8 +1863,18 @@ EngravingItem* EngravingItem::prevSegmentElement()
     return score()->firstElement();
 }
 
+//---------------------------------------------------------
+//   accessible
+///   The accessible object is only created when an assistive
+///   technology client is active, at the first query or focus
+//---------------------------------------------------------
+
 mu::engraving::AccessibleItem* EngravingItem::accessible() const
 {
+    if (!m_accessible && m_accessibleEnabled && mu::engraving::AccessibleItem::isActive()) {
+        m_accessible = const_cast<EngravingItem*>(this)->createAccessible();
+        m_accessible->setup();
+    }
     return m_accessible;
 }
 
@@ -2554,12 +2561,12 @@ void EngravingItem::setSelected(bool f)
     setFlag(ElementFlag::SELECTED, f);
 
     if (f) {
-        if (m_accessible) {
-            AccessibleRoot* accroot = m_accessible->accessibleRoot();
+        if (mu::engraving::AccessibleItem* access = accessible()) {
+            AccessibleRoot* accroot = access->accessibleRoot();
             if (!accroot) {
                 return;
             }
-            accroot->setFocusedElement(m_accessible);
+            accroot->setFocusedElement(access);
         }
     }
 }
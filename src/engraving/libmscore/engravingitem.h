@@ -206,7 +206,9 @@ class EngravingItem : public EngravingObject
     ///< valid after call to layout()
     uint _tag;                    ///< tag bitmask
 
-    mu::engraving::AccessibleItem* m_accessible = nullptr;
+    //! NOTE Created on demand, see accessible()
+    mutable mu::engraving::AccessibleItem* m_accessible = nullptr;
+    bool m_accessibleEnabled = false;
 
 public:
     enum class EditBehavior {
@@ -562,6 +564,7 @@ public:
     virtual EngravingItem* prevSegmentElement();    //< next-element and prev-element command
 
     mu::engraving::AccessibleItem* accessible() const;
+    bool hasAccessible() const { return m_accessible != nullptr; }
     virtual QString accessibleInfo() const;           //< used to populate the status bar
     virtual QString screenReaderInfo() const          //< by default returns accessibleInfo, but can be overridden
     {
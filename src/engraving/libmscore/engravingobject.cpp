@@ -22,9 +22,6 @@
 
 #include "engravingobject.h"
 
-#include <iterator>
-#include <unordered_set>
-
 #include "translation.h"
 #include "io/xml.h"
 
@@ -51,7 +48,15 @@ ElementStyle const EngravingObject::emptyStyle;
 
 EngravingObject* EngravingObjectList::at(size_t i) const
 {
-    return *std::next(begin(), i);
+    IF_ASSERT_FAILED(i < m_size) {
+        return nullptr;
+    }
+
+    EngravingObject* o = m_first;
+    for (; i > 0; --i) {
+        o = o->m_nextSibling;
+    }
+    return o;
 }
 
 EngravingObject::EngravingObject(const ElementType& type, EngravingObject* parent)
@@ -96,25 +101,31 @@ EngravingObject::EngravingObject(const EngravingObject& se)
 
 EngravingObject::~EngravingObject()
 {
-    for (EngravingObject* c : m_children) {
-        c->m_parent = nullptr;
-    }
-
+    EngravingObject* dummy = nullptr;
+    bool hasScore = true;
     if (!isDummy() && !isScore()) {
         Score* sc = score();
         IF_ASSERT_FAILED(sc) {
-            return;
+            hasScore = false;
+        } else if (sc->dummy() != this) {
+            dummy = sc->dummy();
         }
+    }
 
-        auto dummy = sc->dummy();
-        if (dummy && dummy != this) {
-            for (EngravingObject* c : m_children) {
-                c->m_parent = dummy;
-                c->m_parent->addChild(c);
-            }
+    //! NOTE The sibling links live in the children, so they must be unlinked
+    //! before they are moved to the dummy (or left without a parent)
+    while (EngravingObject* c = m_children.front()) {
+        m_children.remove(c);
+        c->m_parent = dummy;
+        if (dummy) {
+            dummy->addChild(c);
         }
     }
 
+    if (!hasScore) {
+        return;
+    }
+
     doSetParent(nullptr);
 
     if (elementsProvider()) {
@@ -138,18 +149,11 @@ void EngravingObject::doSetParent(EngravingObject* p)
     }
 
 #ifdef BUILD_DIAGNOSTICS
-    // check recursion
-    {
-        std::unordered_set<EngravingObject*> used;
-        used.insert(this);
-        EngravingObject* pi = p;
-        while (pi) {
-            IF_ASSERT_FAILED(used.find(pi) == used.end()) {
-                LOGE() << "recursion detected";
-                return;
-            }
-            used.insert(pi);
-            pi = pi->m_parent;
+    // check recursion (the tree itself is acyclic, so it is enough to look for this among the new ancestors)
+    for (const EngravingObject* pi = p; pi; pi = pi->m_parent) {
+        IF_ASSERT_FAILED(pi != this) {
+            LOGE() << "recursion detected";
+            return;
         }
     }
 #endif
@@ -650,7 +654,8 @@ void EngravingObject::setScore(Score* s)
 void EngravingObject::addChild(EngravingObject* o)
 {
 #ifdef BUILD_DIAGNOSTICS
-    IF_ASSERT_FAILED(std::find(m_children.begin(), m_children.end(), o) == m_children.end()) {
+    //! NOTE An object is in at most one children list, so this is O(1)
+    IF_ASSERT_FAILED(!m_children.contains(o)) {
         return;
     }
 #endif
@@ -23,6 +23,8 @@
 #ifndef MU_ENGRAVING_OBJECT_H
 #define MU_ENGRAVING_OBJECT_H
 
+#include <iterator>
+
 #include "types.h"
 #include "infrastructure/draw/geometry.h"
 #include "style/styledef.h"
@@ -163,11 +165,58 @@ enum class PropertyFlags : char;
 class LinkedObjects;
 class EngravingObject;
 
-class EngravingObjectList : public std::list<EngravingObject*>
+//! NOTE Intrusive doubly-linked list of children: the sibling links live in the children themselves,
+//! so adding and removing a child is O(1) and the insertion order is kept
+class EngravingObjectList
 {
 public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = EngravingObject*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = EngravingObject* const*;
+        using reference = EngravingObject*;
+
+        explicit const_iterator(EngravingObject* obj = nullptr)
+            : m_obj(obj) {}
+
+        EngravingObject* operator*() const { return m_obj; }
+        inline const_iterator& operator++();
+        const_iterator operator++(int) { const_iterator it = *this; ++(*this); return it; }
+
+        bool operator==(const const_iterator& other) const { return m_obj == other.m_obj; }
+        bool operator!=(const const_iterator& other) const { return m_obj != other.m_obj; }
+
+    private:
+        EngravingObject* m_obj = nullptr;
+    };
+
+    EngravingObjectList() = default;
+    EngravingObjectList(const EngravingObjectList&) = delete;
+    EngravingObjectList& operator=(const EngravingObjectList&) = delete;
+
+    const_iterator begin() const { return const_iterator(m_first); }
+    const_iterator end() const { return const_iterator(); }
 
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    EngravingObject* front() const { return m_first; }
+    EngravingObject* back() const { return m_last; }
     EngravingObject* at(size_t i) const;
+
+private:
+    friend class EngravingObject;
+
+    inline bool contains(const EngravingObject* o) const;
+    inline void push_back(EngravingObject* o);
+    inline void remove(EngravingObject* o);
+
+    EngravingObject* m_first = nullptr;
+    EngravingObject* m_last = nullptr;
+    size_t m_size = 0;
 };
 
 class EngravingObject
@@ -179,11 +228,15 @@ class EngravingObject
     bool m_isParentExplicitlySet = false;
     bool m_isDummy = false;
     EngravingObjectList m_children;
+    EngravingObject* m_prevSibling = nullptr;
+    EngravingObject* m_nextSibling = nullptr;
 
     Score* _score = nullptr;
 
     static ElementStyle const emptyStyle;
 
+    friend class EngravingObjectList;
+
     void doSetParent(EngravingObject* p);
 
 protected:
@@ -500,6 +553,51 @@ public:
     }
 };
 
+//---------------------------------------------------------
+//   EngravingObjectList
+//---------------------------------------------------------
+
+EngravingObjectList::const_iterator& EngravingObjectList::const_iterator::operator++()
+{
+    m_obj = m_obj->m_nextSibling;
+    return *this;
+}
+
+bool EngravingObjectList::contains(const EngravingObject* o) const
+{
+    return o->m_prevSibling || o->m_nextSibling || m_first == o;
+}
+
+void EngravingObjectList::push_back(EngravingObject* o)
+{
+    o->m_prevSibling = m_last;
+    o->m_nextSibling = nullptr;
+    if (m_last) {
+        m_last->m_nextSibling = o;
+    } else {
+        m_first = o;
+    }
+    m_last = o;
+    ++m_size;
+}
+
+void EngravingObjectList::remove(EngravingObject* o)
+{
+    if (o->m_prevSibling) {
+        o->m_prevSibling->m_nextSibling = o->m_nextSibling;
+    } else {
+        m_first = o->m_nextSibling;
+    }
+    if (o->m_nextSibling) {
+        o->m_nextSibling->m_prevSibling = o->m_prevSibling;
+    } else {
+        m_last = o->m_prevSibling;
+    }
+    o->m_prevSibling = nullptr;
+    o->m_nextSibling = nullptr;
+    --m_size;
+}
+
 //---------------------------------------------------
 // safe casting of ScoreElement
 //
@@ -25,6 +25,8 @@
 #ifndef __FRACTION_H__
 #define __FRACTION_H__
 
+#include <numeric>
+
 #include "config.h"
 #include "mscore.h"
 
@@ -38,19 +40,7 @@ namespace Ms {
 
 static int_least64_t gcd(int_least64_t a, int_least64_t b)
 {
-    int bp;
-    if (b > a) {
-        bp = b;
-        b = a;
-        a = bp;
-    }                                       // Saves one % if true
-    while (b != 0) {
-        bp = b;
-        b = a % b;
-        a = bp;
-    }
-
-    return a >= 0 ? a : -a;
+    return std::gcd(a, b);
 }
 
 //---------------------------------------------------------
@@ -124,6 +114,9 @@ public:
 
     void reduce()
     {
+        if (_denominator == 1) {
+            return;                              // nothing to reduce, skip the gcd
+        }
         const int g = gcd(_numerator, _denominator);
         _numerator /= g;
         _denominator /= g;
@@ -131,6 +124,9 @@ public:
 
     Fraction reduced() const
     {
+        if (_denominator == 1) {
+            return *this;
+        }
         const int g = gcd(_numerator, _denominator);
         return Fraction(_numerator / g, _denominator / g);
     }
@@ -173,6 +169,13 @@ public:
     {
         if (_denominator == val._denominator) {
             _numerator += val._numerator;        // Common enough use case to be handled separately for efficiency
+        } else if (_denominator > 0 && val._denominator % _denominator == 0) {
+            // One denominator divides the other (e.g. 1/4 + 1/16): the gcd is
+            // the smaller one, result is the same as below but without computing it
+            _numerator = _numerator * (val._denominator / _denominator) + val._numerator;
+            _denominator = val._denominator;
+        } else if (val._denominator > 0 && _denominator % val._denominator == 0) {
+            _numerator += val._numerator * (_denominator / val._denominator);
         } else {
             const int g = gcd(_denominator, val._denominator);
             const int m1 = val._denominator / g;       // This saves one division over straight lcm
@@ -186,6 +189,11 @@ public:
     {
         if (_denominator == val._denominator) {
             _numerator -= val._numerator;       // Common enough use case to be handled separately for efficiency
+        } else if (_denominator > 0 && val._denominator % _denominator == 0) {
+            _numerator = _numerator * (val._denominator / _denominator) - val._numerator;
+            _denominator = val._denominator;
+        } else if (val._denominator > 0 && _denominator % val._denominator == 0) {
+            _numerator -= val._numerator * (_denominator / val._denominator);
         } else {
             const int g = gcd(_denominator, val._denominator);
             const int m1 = val._denominator / g;       // This saves one division over straight lcm
@@ -249,7 +257,11 @@ public:
         if (ticks == -1) {
             return Fraction(-1, 1);        // HACK
         }
-        return Fraction(ticks, MScore::division * 4).reduced();
+        const int wholeTicks = MScore::division * 4;
+        if (ticks % wholeTicks == 0) {
+            return Fraction(ticks / wholeTicks, 1);     // whole measures of 4/4, no gcd needed
+        }
+        return Fraction(ticks, wholeTicks).reduced();
     }
 
     //---------------------------------------------------------
@@ -22,6 +22,8 @@
 
 #include "instrtemplate.h"
 
+#include <QHash>
+
 #include "translation.h"
 #include "style/style.h"
 #include "io/xml.h"
@@ -42,6 +44,46 @@ QList<InstrumentGenre*> instrumentGenres;
 QList<InstrumentFamily*> instrumentFamilies;
 QList<ScoreOrder> instrumentOrders;
 
+//---------------------------------------------------------
+//   template index
+//    searchTemplate() is called for every instrument while
+//    loading the templates and for every part while loading
+//    scores, so look up by id through a hash instead of
+//    walking all groups
+//---------------------------------------------------------
+
+static QHash<QString, InstrumentTemplate*> templatesById;
+static QHash<QString, InstrumentTemplate*> templatesByMusicXmlId;
+
+static void addTemplateToIndex(InstrumentTemplate* t)
+{
+    // the first template with an id wins, like the linear search did
+    if (!templatesById.contains(t->id)) {
+        templatesById.insert(t->id, t);
+    }
+}
+
+//---------------------------------------------------------
+//   rebuildTemplateIndex
+//    after loading, index in group order so that the
+//    results are the same as searching group by group
+//---------------------------------------------------------
+
+static void rebuildTemplateIndex()
+{
+    templatesById.clear();
+    templatesByMusicXmlId.clear();
+
+    for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
+        for (InstrumentTemplate* t : qAsConst(g->instrumentTemplates)) {
+            addTemplateToIndex(t);
+            if (!templatesByMusicXmlId.contains(t->musicXMLid)) {
+                templatesByMusicXmlId.insert(t->musicXMLid, t);
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   searchInstrumentGenre
 //---------------------------------------------------------
@@ -147,11 +189,13 @@ void InstrumentGroup::read(XmlReader& e)
                 instrumentTemplates.append(t);
             }
             t->read(e);
+            addTemplateToIndex(t);
         } else if (tag == "ref") {
             InstrumentTemplate* ttt = searchTemplate(e.readElementText());
             if (ttt) {
                 InstrumentTemplate* t = new InstrumentTemplate(*ttt);
                 instrumentTemplates.append(t);
+                addTemplateToIndex(t);
             } else {
                 qDebug("instrument reference not found <%s>", e.text().toUtf8().data());
             }
@@ -644,6 +688,8 @@ void clearInstrumentTemplates()
     instrumentFamilies.clear();
     articulation.clear();
     instrumentOrders.clear();
+    templatesById.clear();
+    templatesByMusicXmlId.clear();
 }
 
 //---------------------------------------------------------
@@ -704,6 +750,8 @@ bool loadInstrumentTemplates(const QString& instrTemplates)
         }
     }
 
+    rebuildTemplateIndex();
+
     return true;
 }
 
@@ -713,14 +761,7 @@ bool loadInstrumentTemplates(const QString& instrTemplates)
 
 InstrumentTemplate* searchTemplate(const QString& name)
 {
-    for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
-        for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
-            if (it->id == name) {
-                return it;
-            }
-        }
-    }
-    return 0;
+    return templatesById.value(name, nullptr);
 }
 
 //---------------------------------------------------------
@@ -729,14 +770,7 @@ InstrumentTemplate* searchTemplate(const QString& name)
 
 InstrumentTemplate* searchTemplateForMusicXmlId(const QString& mxmlId)
 {
-    for (InstrumentGroup* g : qAsConst(instrumentGroups)) {
-        for (InstrumentTemplate* it : qAsConst(g->instrumentTemplates)) {
-            if (it->musicXMLid == mxmlId) {
-                return it;
-            }
-        }
-    }
-    return 0;
+    return templatesByMusicXmlId.value(mxmlId, nullptr);
 }
 
 InstrumentTemplate* searchTemplateForInstrNameList(const QList<QString>& nameList)
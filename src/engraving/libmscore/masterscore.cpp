@@ -59,6 +59,10 @@ MasterScore::MasterScore(std::shared_ptr<engraving::EngravingProject> project)
 {
     m_project = project;
     _undoStack   = new UndoStack();
+    if (engravingConfiguration()) {
+        _undoStack->setMaxUndoDepth(engravingConfiguration()->undoHistoryMaxDepth());
+        m_incrementalSaveEnabled = engravingConfiguration()->isIncrementalSaveEnabled();
+    }
     _tempomap    = new TempoMap;
     _sigmap      = new TimeSigMap();
     _repeatList  = new RepeatList(this);
@@ -26,6 +26,7 @@
 
 #include "score.h"
 #include "instrument.h"
+#include "iengravingconfiguration.h"
 
 namespace mu::engraving {
 class EngravingProject;
@@ -77,6 +78,9 @@ public:
 class MasterScore : public Score
 {
     Q_OBJECT
+
+    INJECT(engraving, mu::engraving::IEngravingConfiguration, engravingConfiguration)
+
     UndoStack * _undoStack = nullptr;
     TimeSigMap* _sigmap;
     TempoMap* _tempomap;
@@ -90,6 +94,7 @@ class MasterScore : public Score
     Revisions* _revisions;
 
     bool _readOnly = false;
+    bool m_incrementalSaveEnabled = false;
 
     CmdState _cmdState;       // modified during cmd processing
 
@@ -142,6 +147,10 @@ public:
     bool isMaster() const override { return true; }
     bool readOnly() const override { return _readOnly; }
     void setReadOnly(bool ro) { _readOnly = ro; }
+
+    //! NOTE If enabled, saves only write again the measures changed since the previous save
+    bool isIncrementalSaveEnabled() const { return m_incrementalSaveEnabled; }
+    void setIncrementalSaveEnabled(bool enabled) { m_incrementalSaveEnabled = enabled; }
     UndoStack* undoStack() const override { return _undoStack; }
     TimeSigMap* sigmap() const override { return _sigmap; }
     TempoMap* tempomap() const override { return _tempomap; }
@@ -22,6 +22,8 @@
 
 #include "measurebase.h"
 
+#include <atomic>
+
 #include "io/xml.h"
 
 #include "factory.h"
@@ -41,18 +43,24 @@ using namespace mu;
 using namespace mu::engraving;
 
 namespace Ms {
+static ID newMeasureUid()
+{
+    static std::atomic<ID> lastUid { INVALID_ID };
+    return ++lastUid;
+}
+
 //---------------------------------------------------------
 //   MeasureBase
 //---------------------------------------------------------
 
 MeasureBase::MeasureBase(const ElementType& type, System* system)
-    : EngravingItem(type, system)
+    : EngravingItem(type, system), m_uid(newMeasureUid())
 {
     setIrregular(true);
 }
 
 MeasureBase::MeasureBase(const MeasureBase& m)
-    : EngravingItem(m)
+    : EngravingItem(m), m_uid(newMeasureUid())
 {
     _next     = m._next;
     _prev     = m._prev;
@@ -81,6 +81,7 @@ class MeasureBase : public EngravingItem
     int _no                { 0 };         ///< Measure number, counting from zero
     int _noOffset          { 0 };         ///< Offset to measure number
     qreal m_oldWidth       { 0 };         ///< Used to restore layout during recalculations in Score::collectSystem()
+    ID m_uid               { INVALID_ID };///< Unique for the whole run, also for copies, never reused after deletion
 
 protected:
 
@@ -149,6 +150,8 @@ public:
 
     Fraction endTick() const { return _tick + _len; }
 
+    ID uid() const { return m_uid; }
+
     void triggerLayout() const override;
 
     qreal pause() const;
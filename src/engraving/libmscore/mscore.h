@@ -120,6 +120,8 @@ static constexpr int MAX_STAVES = 4;
 
 static constexpr int SHADOW_NOTE_LIGHT = 135;
 
+static constexpr int DEFAULT_UNDO_DEPTH = 500; // undo steps kept per score, 0 means unlimited
+
 static constexpr char mimeSymbolFormat[]     = "application/musescore/symbol";
 static constexpr char mimeSymbolListFormat[] = "application/musescore/symbollist";
 static constexpr char mimeStaffListFormat[]  = "application/musescore/stafflist";
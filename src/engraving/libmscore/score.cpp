@@ -34,6 +34,7 @@
 #include "compat/writescorehook.h"
 #include "compat/dummyelement.h"
 #include "io/xml.h"
+#include "rw/measurewritecache.h"
 
 #include "articulation.h"
 #include "audio.h"
@@ -3221,7 +3222,7 @@ void Score::selectAdd(EngravingItem* e)
             selState = SelState::RANGE;
             _selection.updateSelectedElements();
         }
-    } else if (!_selection.elements().contains(e)) {
+    } else if (!_selection.contains(e)) {
         addRefresh(e->abbox());
         selState = SelState::LIST;
         _selection.add(e);
@@ -5196,6 +5197,46 @@ std::list<MidiInputEvent>* Score::activeMidiPitches() { return _masterScore->act
 
 void Score::setUpdateAll() { _masterScore->setUpdateAll(); }
 
+//---------------------------------------------------------
+//   measureWriteCache
+//    nullptr if incremental save is disabled
+//---------------------------------------------------------
+
+mu::engraving::rw::MeasureWriteCache* Score::measureWriteCache()
+{
+    if (!_masterScore->isIncrementalSaveEnabled()) {
+        m_measureWriteCache.reset();
+        return nullptr;
+    }
+
+    if (!m_measureWriteCache) {
+        m_measureWriteCache = std::make_unique<mu::engraving::rw::MeasureWriteCache>();
+    }
+
+    return m_measureWriteCache.get();
+}
+
+void Score::invalidateMeasureWriteCache()
+{
+    if (m_measureWriteCache) {
+        m_measureWriteCache->invalidate();
+    }
+}
+
+void Score::invalidateMeasureWriteCache(const MeasureBase* measure)
+{
+    if (m_measureWriteCache) {
+        m_measureWriteCache->invalidate(measure);
+    }
+}
+
+void Score::invalidateMeasureWriteCache(const Fraction& startTick, const Fraction& endTick)
+{
+    if (m_measureWriteCache) {
+        m_measureWriteCache->invalidate(startTick, endTick);
+    }
+}
+
 void Score::setLayoutAll(int staff, const EngravingItem* e) { _masterScore->setLayoutAll(staff, e); }
 void Score::setLayout(const Fraction& tick, int staff, const EngravingItem* e) { _masterScore->setLayout(tick, staff, e); }
 void Score::setLayout(const Fraction& tick1, const Fraction& tick2, int staff1, int staff2, const EngravingItem* e)
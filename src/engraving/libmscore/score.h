@@ -28,6 +28,7 @@
  Definition of Score class.
 */
 
+#include <memory>
 #include <set>
 
 #include <QQueue>
@@ -65,6 +66,10 @@ class AccessibleScore;
 class Read400;
 }
 
+namespace mu::engraving::rw {
+class MeasureWriteCache;
+}
+
 namespace mu::engraving::compat {
 class Read302;
 class WriteScoreHook;
@@ -476,6 +481,8 @@ private:
     mu::engraving::Layout m_layout;
     mu::engraving::LayoutOptions m_layoutOptions;
 
+    std::unique_ptr<mu::engraving::rw::MeasureWriteCache> m_measureWriteCache;
+
     ChordRest* nextMeasure(ChordRest* element, bool selectBehavior = false, bool mmRest = false);
     ChordRest* prevMeasure(ChordRest* element, bool mmRest = false);
 
@@ -1102,6 +1109,11 @@ public:
 
     //! NOTE Layout
     const mu::engraving::LayoutOptions& layoutOptions() const { return m_layoutOptions; }
+
+    mu::engraving::rw::MeasureWriteCache* measureWriteCache();
+    void invalidateMeasureWriteCache();
+    void invalidateMeasureWriteCache(const MeasureBase* measure);
+    void invalidateMeasureWriteCache(const Fraction& startTick, const Fraction& endTick);
     void setLayoutMode(mu::engraving::LayoutMode lm) { m_layoutOptions.mode = lm; }
     void setShowVBox(bool v) { m_layoutOptions.showVBox = v; }
 
@@ -25,6 +25,8 @@
  Implementation of class Selection plus other selection related functions.
 */
 
+#include <algorithm>
+
 #include <QBuffer>
 
 #include "io/xml.h"
@@ -257,7 +259,10 @@ bool Selection::isEndActive() const
 
 EngravingItem* Selection::element() const
 {
-    return ((state() != SelState::RANGE) && (_el.size() == 1)) ? _el[0] : 0;
+    if (state() == SelState::RANGE || _elSet.size() != 1) {
+        return 0;
+    }
+    return *_elSet.begin();
 }
 
 ChordRest* Selection::cr() const
@@ -329,7 +334,7 @@ Segment* Selection::firstChordRestSegment() const
 
 ChordRest* Selection::firstChordRest(int track) const
 {
-    if (_el.size() == 1) {
+    if (elements().size() == 1) {
         EngravingItem* el = _el[0];
         if (el->isNote()) {
             return toChordRest(el->parent());
@@ -339,7 +344,7 @@ ChordRest* Selection::firstChordRest(int track) const
         return 0;
     }
     ChordRest* cr = 0;
-    for (EngravingItem* el : _el) {
+    for (EngravingItem* el : elements()) {
         if (el->isNote()) {
             el = el->parentItem();
         }
@@ -361,7 +366,7 @@ ChordRest* Selection::firstChordRest(int track) const
 
 ChordRest* Selection::lastChordRest(int track) const
 {
-    if (_el.size() == 1) {
+    if (elements().size() == 1) {
         EngravingItem* el = _el[0];
         if (el) {
             if (el->isNote()) {
@@ -373,7 +378,7 @@ ChordRest* Selection::lastChordRest(int track) const
         return nullptr;
     }
     ChordRest* cr = nullptr;
-    for (auto el : _el) {
+    for (auto el : elements()) {
         if (el->isNote()) {
             el = toNote(el)->chord();
         }
@@ -396,7 +401,7 @@ ChordRest* Selection::lastChordRest(int track) const
 Measure* Selection::findMeasure() const
 {
     Measure* m = 0;
-    if (_el.size() > 0) {
+    if (!elements().empty()) {
         EngravingItem* el = _el[0];
         m = toMeasure(el->findMeasure());
     }
@@ -427,6 +432,7 @@ void Selection::clear()
         return;
     }
 
+    compact();
     for (EngravingItem* e : qAsConst(_el)) {
         if (e->isSpanner()) {       // TODO: only visible elements should be selectable?
             Spanner* sp = toSpanner(e);
@@ -438,6 +444,7 @@ void Selection::clear()
         }
     }
     _el.clear();
+    _elSet.clear();
     _startSegment  = 0;
     _endSegment    = 0;
     _activeSegment = 0;
@@ -449,9 +456,10 @@ void Selection::clear()
 
 void Selection::remove(EngravingItem* el)
 {
-    const bool removed = _el.removeOne(el);
+    const bool removed = _elSet.erase(el) > 0;
     el->setSelected(false);
     if (removed) {
+        ++_removedCount;
         updateState();
     }
 }
@@ -462,8 +470,46 @@ void Selection::add(EngravingItem* el)
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    _el.append(el);
-    update();
+    if (append(el)) {
+        el->setSelected(true);
+    }
+    updateState();
+}
+
+//---------------------------------------------------------
+//   append
+///   Append to the list, if not selected yet
+//---------------------------------------------------------
+
+bool Selection::append(EngravingItem* e)
+{
+    if (contains(e)) {
+        return false;
+    }
+    // an element removed earlier may still be in the list
+    compact();
+    _elSet.insert(e);
+    _el.append(e);
+    return true;
+}
+
+//---------------------------------------------------------
+//   compact
+///   Drop the removed elements from the list, in place
+///   (like removeOne() did) so it isn't reallocated
+///   under a caller iterating it
+//---------------------------------------------------------
+
+void Selection::compact() const
+{
+    if (_removedCount == 0) {
+        return;
+    }
+    auto end = std::remove_if(_el.begin(), _el.end(), [this](EngravingItem* e) {
+        return _elSet.find(e) == _elSet.end();
+    });
+    _el.erase(end, _el.end());
+    _removedCount = 0;
 }
 
 void Selection::appendFiltered(EngravingItem* e)
@@ -473,7 +519,7 @@ void Selection::appendFiltered(EngravingItem* e)
         return;
     }
     if (selectionFilter().canSelect(e)) {
-        _el.append(e);
+        append(e);
     }
 }
 
@@ -483,34 +529,34 @@ void Selection::appendChord(Chord* chord)
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    if (chord->beam() && !_el.contains(chord->beam())) {
-        _el.append(chord->beam());
+    if (chord->beam()) {
+        append(chord->beam());
     }
     if (chord->stem()) {
-        _el.append(chord->stem());
+        append(chord->stem());
     }
     if (chord->hook()) {
-        _el.append(chord->hook());
+        append(chord->hook());
     }
     if (chord->arpeggio()) {
         appendFiltered(chord->arpeggio());
     }
     if (chord->stemSlash()) {
-        _el.append(chord->stemSlash());
+        append(chord->stemSlash());
     }
     if (chord->tremolo()) {
         appendFiltered(chord->tremolo());
     }
     for (Note* note : chord->notes()) {
-        _el.append(note);
+        append(note);
         if (note->accidental()) {
-            _el.append(note->accidental());
+            append(note->accidental());
         }
         foreach (EngravingItem* el, note->el()) {
             appendFiltered(el);
         }
         for (NoteDot* dot : note->dots()) {
-            _el.append(dot);
+            append(dot);
         }
 
         if (note->tieFor() && (note->tieFor()->endElement() != 0)) {
@@ -518,7 +564,7 @@ void Selection::appendChord(Chord* chord)
                 Note* endNote = toNote(note->tieFor()->endElement());
                 Segment* s = endNote->chord()->segment();
                 if (s->tick() < tickEnd()) {
-                    _el.append(note->tieFor());
+                    append(note->tieFor());
                 }
             }
         }
@@ -527,7 +573,7 @@ void Selection::appendChord(Chord* chord)
                 Note* endNote = toNote(sp->endElement());
                 Segment* s = endNote->chord()->segment();
                 if (s->tick() < tickEnd()) {
-                    _el.append(sp);
+                    append(sp);
                 }
             }
         }
@@ -569,10 +615,12 @@ void Selection::updateSelectedElements()
         _plannedTick2 = Fraction(-1, 1);
     }
 
+    compact();
     for (EngravingItem* e : qAsConst(_el)) {
         e->setSelected(false);
     }
     _el.clear();
+    _elSet.clear();
 
     // assert:
     int staves = _score->nstaves();
@@ -707,7 +755,7 @@ void Selection::setRangeTicks(const Fraction& tick1, const Fraction& tick2, int
 
 void Selection::update()
 {
-    for (EngravingItem* e : qAsConst(_el)) {
+    for (EngravingItem* e : elements()) {
         e->setSelected(true);
     }
     updateState();
@@ -724,7 +772,7 @@ void Selection::dump()
     case SelState::LIST:   qDebug("LIST");
         break;
     }
-    foreach (const EngravingItem* e, _el) {
+    foreach (const EngravingItem* e, elements()) {
         qDebug("  %p %s", e, e->name());
     }
 }
@@ -736,7 +784,7 @@ void Selection::dump()
 
 void Selection::updateState()
 {
-    int n = _el.size();
+    const size_t n = _elSet.size();
     EngravingItem* e = element();
     if (n == 0) {
         setState(SelState::NONE);
@@ -901,7 +949,7 @@ QByteArray Selection::symbolListMimeData() const
     std::multimap<qint64, MapData> map;
 
     // scan selection element list, inserting relevant elements in a tick-sorted map
-    foreach (EngravingItem* e, _el) {
+    foreach (EngravingItem* e, elements()) {
         switch (e->type()) {
         /* All these element types are ignored:
 
@@ -1118,7 +1166,7 @@ std::vector<Note*> Selection::noteList(int selTrack) const
     std::vector<Note*> nl;
 
     if (_state == SelState::LIST) {
-        foreach (EngravingItem* e, _el) {
+        foreach (EngravingItem* e, elements()) {
             if (e->isNote()) {
                 nl.push_back(toNote(e));
             }
@@ -1321,17 +1369,18 @@ bool Selection::measureRange(Measure** m1, Measure** m2) const
 const QList<EngravingItem*> Selection::uniqueElements() const
 {
     QList<EngravingItem*> l;
+    std::unordered_set<const EngravingObject*> seen;
 
     for (EngravingItem* e : elements()) {
-        bool alreadyThere = false;
-        for (EngravingItem* ee : l) {
-            if ((ee->links() && ee->links()->contains(e)) || e == ee) {
-                alreadyThere = true;
-                break;
-            }
+        if (seen.find(e) != seen.end()) {
+            continue;
         }
-        if (!alreadyThere) {
-            l.append(e);
+        l.append(e);
+        seen.insert(e);
+        if (e->links()) {
+            for (const EngravingObject* linked : *e->links()) {
+                seen.insert(linked);
+            }
         }
     }
     return l;
@@ -23,6 +23,8 @@
 #ifndef __SELECT_H__
 #define __SELECT_H__
 
+#include <unordered_set>
+
 #include "pitchspelling.h"
 #include "mscore.h"
 #include "durationtype.h"
@@ -153,7 +155,11 @@ class Selection
 {
     Score* _score;
     SelState _state;
-    QList<EngravingItem*> _el;            // valid in mode SelState::LIST
+    //! NOTE The selected elements in the order of selection and a hash set of them, valid in mode SelState::LIST.
+    //! remove() only takes an element out of the set, the list is compacted in one go on the next read
+    mutable QList<EngravingItem*> _el;
+    std::unordered_set<EngravingItem*> _elSet;
+    mutable size_t _removedCount = 0;
 
     int _staffStart = 0;            // valid if selState is SelState::RANGE
     int _staffEnd = 0;
@@ -178,8 +184,10 @@ class Selection
     SelectionFilter selectionFilter() const;
     bool canSelect(EngravingItem* e) const { return selectionFilter().canSelect(e); }
     bool canSelectVoice(int track) const { return selectionFilter().canSelectVoice(track); }
+    bool append(EngravingItem* e);
     void appendFiltered(EngravingItem* e);
     void appendChord(Chord* chord);
+    void compact() const;
 
 public:
     Selection() { _score = 0; _state = SelState::NONE; }
@@ -197,13 +205,14 @@ public:
     bool isLocked() const { return !_lockReason.isEmpty(); }
     const QString& lockReason() const { return _lockReason; }
 
-    const QList<EngravingItem*>& elements() const { return _el; }
+    const QList<EngravingItem*>& elements() const { compact(); return _el; }
+    bool contains(const EngravingItem* e) const { return _elSet.find(const_cast<EngravingItem*>(e)) != _elSet.end(); }
     std::vector<Note*> noteList(int track = -1) const;
 
     const QList<EngravingItem*> uniqueElements() const;
     QList<Note*> uniqueNotes(int track = -1) const;
 
-    bool isSingle() const { return (_state == SelState::LIST) && (_el.size() == 1); }
+    bool isSingle() const { return (_state == SelState::LIST) && (_elSet.size() == 1); }
 
     void add(EngravingItem*);
     void deselectAll();
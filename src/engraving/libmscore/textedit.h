@@ -70,6 +70,12 @@ public:
     }
 
     TextCursor& cursor() { return _cursor; }
+
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override
+    {
+        objects.push_back(_cursor.text());
+        return true;
+    }
 };
 
 //---------------------------------------------------------
@@ -332,6 +332,7 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
 #endif
     curCmd->appendChild(cmd);
     cmd->redo(ed);
+    curCmd->invalidateMeasureWriteCache(cmd);
 }
 
 //---------------------------------------------------------
@@ -380,6 +381,8 @@ void UndoStack::remove(int idx)
 
 void UndoStack::mergeCommands(int startIdx)
 {
+    // convert absolute index, macros before it may have been dropped already
+    startIdx = std::max(startIdx - trimmedCount, 0);
     Q_ASSERT(startIdx <= curIdx);
 
     if (startIdx >= list.size()) {
@@ -408,6 +411,7 @@ void UndoStack::pop()
     }
     UndoCommand* cmd = curCmd->removeChild();
     cmd->undo(0);
+    curCmd->invalidateMeasureWriteCache(cmd);
 }
 
 //---------------------------------------------------------
@@ -420,6 +424,7 @@ void UndoStack::rollback()
     Q_ASSERT(curCmd == 0);
     Q_ASSERT(curIdx > 0);
     int idx = curIdx - 1;
+    list[idx]->invalidateMeasureWriteCache(list[idx]);
     list[idx]->unwind();
     remove(idx);
 }
@@ -447,10 +452,93 @@ void UndoStack::endMacro(bool rollback)
         list.append(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
+        trim();
     }
     curCmd = 0;
 }
 
+//---------------------------------------------------------
+//   setMaxUndoDepth
+//    limit the number of macros kept in the history,
+//    0 means unlimited
+//---------------------------------------------------------
+
+void UndoStack::setMaxUndoDepth(int depth)
+{
+    maxDepth = std::max(depth, 0);
+    if (!curCmd) {
+        trim();
+    }
+}
+
+//---------------------------------------------------------
+//   trim
+//    drop the oldest macros which exceed maxDepth
+//---------------------------------------------------------
+
+void UndoStack::trim()
+{
+    if (maxDepth <= 0) {
+        return;
+    }
+    while (list.size() > maxDepth && curIdx > 0) {
+        UndoCommand* cmd = list.takeFirst();
+        stateList.erase(stateList.begin());
+        cmd->cleanup(true);
+        delete cmd;
+        --curIdx;
+        ++trimmedCount;
+    }
+}
+
+//---------------------------------------------------------
+//   commandCount
+//    total number of commands kept in the history,
+//    used as a measure of its memory footprint
+//---------------------------------------------------------
+
+static size_t countCommands(const UndoCommand* cmd)
+{
+    size_t n = 1;
+    for (const UndoCommand* c : cmd->commands()) {
+        n += countCommands(c);
+    }
+    return n;
+}
+
+size_t UndoStack::commandCount() const
+{
+    size_t n = 0;
+    for (const UndoMacro* m : list) {
+        n += countCommands(m);
+    }
+    return n;
+}
+
+//---------------------------------------------------------
+//   estimatedMemoryUsage
+//    bytes taken by the command objects of the history,
+//    elements owned by removing commands are not counted
+//---------------------------------------------------------
+
+size_t UndoCommand::estimatedMemoryUsage() const
+{
+    size_t bytes = objectSize() + childList.size() * sizeof(UndoCommand*);
+    for (const UndoCommand* c : childList) {
+        bytes += c->estimatedMemoryUsage();
+    }
+    return bytes;
+}
+
+size_t UndoStack::estimatedMemoryUsage() const
+{
+    size_t bytes = stateList.capacity() * sizeof(int) + list.size() * sizeof(UndoMacro*);
+    for (const UndoMacro* m : list) {
+        bytes += m->estimatedMemoryUsage();
+    }
+    return bytes;
+}
+
 //---------------------------------------------------------
 //   reopen
 //---------------------------------------------------------
@@ -487,7 +575,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = static_cast<TextEditData*>(ed->getData(ed->element));
-        if (ted && ted->startUndoIdx == curIdx) {
+        if (ted && ted->startUndoIdx == getCurIdx()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -568,6 +656,7 @@ void UndoMacro::undo(EditData* ed)
 
     // Undo for child commands.
     UndoCommand::undo(ed);
+    invalidateMeasureWriteCache(this);
 
     score->setInputState(undoInputState);
     if (undoSelectionInfo.isValid()) {
@@ -584,6 +673,7 @@ void UndoMacro::redo(EditData* ed)
 
     // Redo for child commands.
     UndoCommand::redo(ed);
+    invalidateMeasureWriteCache(this);
 
     score->setInputState(redoInputState);
     if (redoSelectionInfo.isValid()) {
@@ -592,6 +682,51 @@ void UndoMacro::redo(EditData* ed)
     }
 }
 
+//---------------------------------------------------------
+//   invalidateMeasureWriteCache
+//    the measures changed by the command have to be written
+//    again on the next save; if the command can't tell what
+//    it changed, nothing written before is reused
+//---------------------------------------------------------
+
+static void invalidateWrittenMeasure(const EngravingObject* obj)
+{
+    Score* s = obj->score();
+    if (!s) {
+        return;
+    }
+
+    //! NOTE Spanners are written in the measures of both their ends
+    if (obj->isEngravingItem() && !obj->isSpanner()) {
+        const MeasureBase* measure = toEngravingItem(obj)->findMeasureBase();
+        if (measure) {
+            s->invalidateMeasureWriteCache(measure);
+            return;
+        }
+    }
+
+    s->invalidateMeasureWriteCache();
+}
+
+void UndoMacro::invalidateMeasureWriteCache(const UndoCommand* cmd) const
+{
+    std::vector<EngravingObject*> objects;
+    if (!cmd->changedObjects(objects)) {
+        for (Score* s : score->masterScore()->scoreList()) {
+            s->invalidateMeasureWriteCache();
+        }
+        return;
+    }
+
+    for (const EngravingObject* obj : objects) {
+        invalidateWrittenMeasure(obj);
+    }
+
+    for (const UndoCommand* child : cmd->commands()) {
+        invalidateMeasureWriteCache(child);
+    }
+}
+
 void UndoMacro::append(UndoMacro&& other)
 {
     appendChildren(&other);
@@ -822,6 +957,12 @@ const char* AddElement::name() const
     return buffer;
 }
 
+bool AddElement::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    objects.push_back(element);
+    return true;
+}
+
 //---------------------------------------------------------
 //   AddElement::isFiltered
 //---------------------------------------------------------
@@ -974,6 +1115,12 @@ const char* RemoveElement::name() const
     return buffer;
 }
 
+bool RemoveElement::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    objects.push_back(element);
+    return true;
+}
+
 //---------------------------------------------------------
 //   RemoveElement::isFiltered
 //---------------------------------------------------------
@@ -1229,6 +1376,12 @@ void ChangePitch::flip(EditData*)
     note->triggerLayout();
 }
 
+bool ChangePitch::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    objects.push_back(note);
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangeFretting
 //
@@ -1271,6 +1424,12 @@ void ChangeFretting::flip(EditData*)
     note->triggerLayout();
 }
 
+bool ChangeFretting::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    objects.push_back(note);
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangeElement
 //---------------------------------------------------------
@@ -1333,6 +1492,13 @@ void ChangeElement::flip(EditData*)
     // score->setLayoutAll();
 }
 
+bool ChangeElement::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    objects.push_back(oldElement);
+    objects.push_back(newElement);
+    return true;
+}
+
 //---------------------------------------------------------
 //   InsertStaves
 //---------------------------------------------------------
@@ -1574,6 +1740,12 @@ void EditText::undoRedo()
     text->triggerLayout();
 }
 
+bool EditText::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    objects.push_back(text);
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangePatch
 //---------------------------------------------------------
@@ -2373,6 +2545,16 @@ void ChangeProperty::flip(EditData*)
     flags = ps;
 }
 
+bool ChangeProperty::changedObjects(std::vector<EngravingObject*>& objects) const
+{
+    if (!element) {
+        return false;
+    }
+
+    objects.push_back(element);
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
@@ -94,7 +94,8 @@ enum class PlayEventType : char;
 class Excerpt;
 class EditData;
 
-#define UNDO_NAME(a)  virtual const char* name() const override { return a; }
+#define UNDO_NAME(a)  virtual const char* name() const override { return a; } \
+    virtual size_t objectSize() const override { return sizeof(*this); }
 
 //---------------------------------------------------------
 //   UndoCommand
@@ -131,8 +132,15 @@ public:
 // #ifndef QT_NO_DEBUG
     virtual const char* name() const { return "UndoCommand"; }
 // #endif
+    virtual size_t objectSize() const { return sizeof(UndoCommand); }
+    size_t estimatedMemoryUsage() const;
 
     virtual bool isFiltered(Filter, const EngravingItem* /* target */) const { return false; }
+
+    //! NOTE Adds the objects changed by the command itself (not by its children),
+    //! returns false if the command may change anything in the score
+    virtual bool changedObjects(std::vector<EngravingObject*>&) const { return false; }
+
     bool hasFilteredChildren(Filter, const EngravingItem* target) const;
     bool hasUnfilteredChildren(const std::vector<Filter>& filters, const EngravingItem* target) const;
     void filterChildren(UndoCommand::Filter f, EngravingItem* target);
@@ -175,6 +183,9 @@ public:
 
     static bool canRecordSelectedElement(const EngravingItem* e);
 
+    bool changedObjects(std::vector<EngravingObject*>&) const override { return true; }
+    void invalidateMeasureWriteCache(const UndoCommand* cmd) const;
+
     UNDO_NAME("UndoMacro");
 };
 
@@ -190,8 +201,11 @@ class UndoStack
     int nextState;
     int cleanState;
     int curIdx;
+    int trimmedCount = 0;       // number of macros dropped from the front of the history
+    int maxDepth = DEFAULT_UNDO_DEPTH; // 0 means unlimited
 
     void remove(int idx);
+    void trim();
 
 public:
     UndoStack();
@@ -208,7 +222,8 @@ public:
     bool canRedo() const { return curIdx < list.size(); }
     int state() const { return stateList[curIdx]; }
     bool isClean() const { return cleanState == state(); }
-    int getCurIdx() const { return curIdx; }
+    //! NOTE Indices are absolute: they stay valid when old macros are dropped by trim()
+    int getCurIdx() const { return curIdx + trimmedCount; }
     bool empty() const { return !canUndo() && !canRedo(); }
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
@@ -220,6 +235,13 @@ public:
 
     void mergeCommands(int startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    int maxUndoDepth() const { return maxDepth; }
+    void setMaxUndoDepth(int depth);
+    int macroCount() const { return list.size(); }
+    int droppedMacroCount() const { return trimmedCount; }
+    size_t commandCount() const;
+    size_t estimatedMemoryUsage() const;
 };
 
 //---------------------------------------------------------
@@ -418,6 +440,7 @@ class ChangePitch : public UndoCommand
 
 public:
     ChangePitch(Note* note, int pitch, int tpc1, int tpc2);
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
     UNDO_NAME("ChangePitch")
 };
 
@@ -437,6 +460,7 @@ class ChangeFretting : public UndoCommand
 
 public:
     ChangeFretting(Note* note, int pitch, int string, int fret, int tpc1, int tpc2);
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
     UNDO_NAME("ChangeFretting")
 };
 
@@ -485,6 +509,7 @@ class ChangeElement : public UndoCommand
 
 public:
     ChangeElement(EngravingItem* oldElement, EngravingItem* newElement);
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
     UNDO_NAME("ChangeElement")
 };
 
@@ -606,6 +631,7 @@ public:
     EngravingItem* getElement() const { return element; }
     virtual void cleanup(bool) override;
     virtual const char* name() const override;
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 };
@@ -624,6 +650,7 @@ public:
     virtual void redo(EditData*) override;
     virtual void cleanup(bool) override;
     virtual const char* name() const override;
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 };
@@ -645,6 +672,7 @@ public:
         : text(t), oldText(ot) /*, undoLevel(l)*/ {}
     virtual void undo(EditData*) override;
     virtual void redo(EditData*) override;
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
     UNDO_NAME("EditText")
 };
 
@@ -1125,6 +1153,7 @@ public:
     Pid getId() const { return id; }
     EngravingObject* getElement() const { return element; }
     QVariant data() const { return property; }
+    bool changedObjects(std::vector<EngravingObject*>& objects) const override;
     UNDO_NAME("ChangeProperty")
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override
@@ -75,7 +75,38 @@ void Paint::paintElements(mu::draw::Painter& painter, const QList<EngravingItem*
     }
 }
 
-void Paint::paintPage(mu::draw::Painter& painter, Ms::Page* page, const RectF& rect)
+void Paint::paintElementsLowDetail(mu::draw::Painter& painter, const QList<EngravingItem*>& elements)
+{
+    TRACEFUNC;
+
+    //! NOTE Staff lines, barlines, stems and beams keep the shape of the music,
+    //! noteheads and rests are reduced to boxes, everything else is skipped
+    for (const EngravingItem* element : elements) {
+        if (!element->isInteractionAvailable()) {
+            continue;
+        }
+
+        switch (element->type()) {
+        case ElementType::STAFF_LINES:
+        case ElementType::BAR_LINE:
+        case ElementType::STEM:
+        case ElementType::BEAM:
+            paintElement(painter, element);
+            break;
+        case ElementType::NOTE:
+        case ElementType::REST:
+        case ElementType::MMREST:
+        case ElementType::MEASURE_REPEAT:
+            element->itemDiscovered = false;
+            painter.fillRect(element->pageBoundingRect(), element->curColor());
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void Paint::paintPage(mu::draw::Painter& painter, Ms::Page* page, const RectF& rect, bool lowDetail)
 {
     PointF pagePosition(page->pos());
     painter.translate(pagePosition);
@@ -83,7 +114,11 @@ void Paint::paintPage(mu::draw::Painter& painter, Ms::Page* page, const RectF& r
     painter.setClipRect(page->bbox());
 
     QList<EngravingItem*> elements = page->items(rect);
-    paintElements(painter, elements);
+    if (lowDetail) {
+        paintElementsLowDetail(painter, elements);
+    } else {
+        paintElements(painter, elements);
+    }
 
 #ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
     DebugPaint::paintPageDiagnostic(painter, page);
@@ -39,7 +39,11 @@ public:
     static void paintElement(mu::draw::Painter& painter, const Ms::EngravingItem* element);
     static void paintElements(mu::draw::Painter& painter, const QList<Ms::EngravingItem*>& elements);
 
-    static void paintPage(mu::draw::Painter& painter, Ms::Page* page, const RectF& rect);
+    static void paintElementsLowDetail(mu::draw::Painter& painter, const QList<Ms::EngravingItem*>& elements);
+
+    //! NOTE With lowDetail only the skeleton of the page is painted (see paintElementsLowDetail),
+    //! meant for views zoomed out so far that the details are not legible anyway
+    static void paintPage(mu::draw::Painter& painter, Ms::Page* page, const RectF& rect, bool lowDetail = false);
 };
 }
 
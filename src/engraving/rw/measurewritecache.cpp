@@ -0,0 +1,147 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "measurewritecache.h"
+
+#include <limits>
+
+#include <QBuffer>
+
+#include "libmscore/measurebase.h"
+
+#include "log.h"
+
+using namespace mu::engraving::rw;
+using namespace Ms;
+
+bool MeasureWriteCache::canCache(const XmlWriter& xml)
+{
+    //! NOTE The fragments are taken back from the written buffer
+    return qobject_cast<QBuffer*>(xml.device())
+           && !xml.clipboardmode()
+           && !xml.recordElements()
+           && !MScore::debugMode;
+}
+
+bool MeasureWriteCache::writeCached(XmlWriter& xml, const MeasureBase* measure, int staffIdx)
+{
+    auto it = m_fragments.find(Key(measure->uid(), staffIdx));
+    if (it == m_fragments.end()) {
+        return false;
+    }
+
+    const Fragment& fragment = it->second;
+    if (fragment.startTick != measure->tick() || fragment.endTick != measure->endTick()) {
+        return false;
+    }
+
+    if (fragment.stateBefore != xml.state()) {
+        return false;
+    }
+
+    //! NOTE Linked elements refer to the local indices assigned while writing other measures
+    for (const auto& lid : fragment.readLidLocalIndices) {
+        if (xml.lidLocalIndex(lid.first) != lid.second) {
+            return false;
+        }
+    }
+
+    xml.flush();
+    xml.device()->write(fragment.data);
+
+    for (const auto& lid : fragment.writtenLidLocalIndices) {
+        xml.setLidLocalIndex(lid.first, lid.second);
+    }
+
+    xml.setState(fragment.stateAfter);
+
+    ++m_hits;
+    return true;
+}
+
+void MeasureWriteCache::beginRecord(XmlWriter& xml, const MeasureBase* measure, int staffIdx)
+{
+    IF_ASSERT_FAILED(!m_recording) {
+        return;
+    }
+
+    m_recording = true;
+    m_recordKey = Key(measure->uid(), staffIdx);
+    m_record = Fragment();
+    m_record.startTick = measure->tick();
+    m_record.endTick = measure->endTick();
+    m_record.stateBefore = xml.state();
+
+    xml.flush();
+    m_recordPos = xml.device()->pos();
+    xml.setLidLocalIndicesRecorders(&m_record.readLidLocalIndices, &m_record.writtenLidLocalIndices);
+}
+
+void MeasureWriteCache::endRecord(XmlWriter& xml)
+{
+    IF_ASSERT_FAILED(m_recording) {
+        return;
+    }
+
+    m_recording = false;
+    xml.setLidLocalIndicesRecorders(nullptr, nullptr);
+    xml.flush();
+
+    QBuffer* buffer = qobject_cast<QBuffer*>(xml.device());
+    IF_ASSERT_FAILED(buffer) {
+        return;
+    }
+
+    m_record.data = buffer->data().mid(m_recordPos, buffer->pos() - m_recordPos);
+    m_record.stateAfter = xml.state();
+
+    m_fragments[m_recordKey] = std::move(m_record);
+}
+
+void MeasureWriteCache::invalidate()
+{
+    m_fragments.clear();
+}
+
+void MeasureWriteCache::invalidate(const MeasureBase* measure)
+{
+    auto it = m_fragments.lower_bound(Key(measure->uid(), std::numeric_limits<int>::min()));
+    while (it != m_fragments.end() && it->first.first == measure->uid()) {
+        it = m_fragments.erase(it);
+    }
+}
+
+void MeasureWriteCache::invalidate(const Fraction& startTick, const Fraction& endTick)
+{
+    if (startTick < Fraction(0, 1) || endTick < Fraction(0, 1)) {
+        invalidate();
+        return;
+    }
+
+    for (auto it = m_fragments.begin(); it != m_fragments.end();) {
+        const Fragment& fragment = it->second;
+        if (fragment.startTick <= endTick && fragment.endTick >= startTick) {
+            it = m_fragments.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_MEASUREWRITECACHE_H
+#define MU_ENGRAVING_MEASUREWRITECACHE_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <QByteArray>
+
+#include "io/xml.h"
+#include "libmscore/mscore.h"
+
+namespace Ms {
+class MeasureBase;
+}
+
+namespace mu::engraving::rw {
+//---------------------------------------------------------
+//   MeasureWriteCache
+//    keeps the written xml of every measure of a score
+//    (per staff), so that a save only has to write again
+//    the measures changed since the previous one.
+//    A fragment is reused only if the writer is in the
+//    same state as when it was recorded. Fragments are
+//    keyed by the measure uid, so they can't be taken for
+//    a new measure allocated at the same address; undo
+//    commands drop the fragments of the measures they change.
+//---------------------------------------------------------
+
+class MeasureWriteCache
+{
+public:
+    MeasureWriteCache() = default;
+
+    static bool canCache(const Ms::XmlWriter& xml);
+
+    //! NOTE Returns false if there is no valid fragment, the measure must be written then
+    bool writeCached(Ms::XmlWriter& xml, const Ms::MeasureBase* measure, int staffIdx);
+
+    void beginRecord(Ms::XmlWriter& xml, const Ms::MeasureBase* measure, int staffIdx);
+    void endRecord(Ms::XmlWriter& xml);
+
+    void invalidate();
+    void invalidate(const Ms::MeasureBase* measure);
+    void invalidate(const Ms::Fraction& startTick, const Ms::Fraction& endTick);
+
+    size_t size() const { return m_fragments.size(); }
+    size_t hits() const { return m_hits; }
+
+private:
+    using Key = std::pair<Ms::ID, int>;
+    using LidLocalIndices = std::vector<std::pair<int, int> >;
+
+    struct Fragment {
+        Ms::Fraction startTick;
+        Ms::Fraction endTick;
+        Ms::XmlWriter::State stateBefore;
+        Ms::XmlWriter::State stateAfter;
+        LidLocalIndices readLidLocalIndices;
+        LidLocalIndices writtenLidLocalIndices;
+        QByteArray data;
+    };
+
+    std::map<Key, Fragment> m_fragments;
+    size_t m_hits = 0;
+
+    bool m_recording = false;
+    Key m_recordKey;
+    Fragment m_record;
+    qint64 m_recordPos = 0;
+};
+}
+
+#endif // MU_ENGRAVING_MEASUREWRITECACHE_H
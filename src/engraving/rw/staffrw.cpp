@@ -29,6 +29,7 @@
 #include "libmscore/staff.h"
 
 #include "measurerw.h"
+#include "measurewritecache.h"
 
 using namespace mu::engraving::rw;
 using namespace Ms;
@@ -148,6 +149,12 @@ void StaffRW::writeStaff(const Ms::Staff* staff, Ms::XmlWriter& xml,
     bool writeSystemElements = (staffIdx == staffStart);
     bool firstMeasureWritten = false;
     bool forceTimeSig = false;
+
+    MeasureWriteCache* cache = nullptr;
+    if (!selectionOnly && MeasureWriteCache::canCache(xml)) {
+        cache = staff->score()->measureWriteCache();
+    }
+
     for (MeasureBase* m = measureStart; m != measureEnd; m = m->next()) {
         // force timesig if first measure and selectionOnly
         if (selectionOnly && m->isMeasure()) {
@@ -158,7 +165,14 @@ void StaffRW::writeStaff(const Ms::Staff* staff, Ms::XmlWriter& xml,
                 forceTimeSig = false;
             }
         }
-        writeMeasure(xml, m, staffIdx, writeSystemElements, forceTimeSig);
+
+        if (!cache) {
+            writeMeasure(xml, m, staffIdx, writeSystemElements, forceTimeSig);
+        } else if (!cache->writeCached(xml, m, staffIdx)) {
+            cache->beginRecord(xml, m, staffIdx);
+            writeMeasure(xml, m, staffIdx, writeSystemElements, forceTimeSig);
+            cache->endRecord(xml);
+        }
     }
 
     xml.endObject();
@@ -0,0 +1,181 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "accessibility/iaccessibilitycontroller.h"
+#include "accessibility/accessibleitem.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/chord.h"
+#include "libmscore/note.h"
+#include "libmscore/rootitem.h"
+
+#include "utils/scorerw.h"
+#include "utils/benchmark.h"
+
+static const QString ACCESSIBILITY_DATA_DIR("all_elements_data/");
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace Ms;
+
+namespace {
+class AccessibilityControllerStub : public accessibility::IAccessibilityController
+{
+public:
+    const accessibility::IAccessible* accessibleRoot() const override { return nullptr; }
+    bool isActive() const override { return active; }
+
+    void reg(accessibility::IAccessible*) override {}
+    void unreg(accessibility::IAccessible*) override {}
+
+    bool active = false;
+};
+}
+
+class AccessibilityTests : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        //! NOTE The accessible items cache the controller, so it is registered once for the whole suite
+        static std::shared_ptr<AccessibilityControllerStub> controller = std::make_shared<AccessibilityControllerStub>();
+        modularity::ioc()->registerExport<accessibility::IAccessibilityController>("utests", controller);
+        s_controller = controller.get();
+    }
+
+    void TearDown() override
+    {
+        s_controller->active = false;
+    }
+
+    //! NOTE All items of the object tree, except the root
+    static std::vector<EngravingItem*> allItems(Score* score)
+    {
+        std::vector<EngravingItem*> items;
+        collectItems(score->rootItem(), items);
+        return items;
+    }
+
+    static void collectItems(const EngravingObject* obj, std::vector<EngravingItem*>& items)
+    {
+        for (EngravingObject* ch : obj->children()) {
+            if (ch->isEngravingItem()) {
+                items.push_back(toEngravingItem(ch));
+            }
+            collectItems(ch, items);
+        }
+    }
+
+    static size_t accessibleCount(Score* score)
+    {
+        size_t count = 0;
+        for (const EngravingItem* e : allItems(score)) {
+            if (e->hasAccessible()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    static AccessibilityControllerStub* s_controller;
+};
+
+AccessibilityControllerStub* AccessibilityTests::s_controller = nullptr;
+
+/**
+ * @brief AccessibilityTests_OnDemand
+ * @details Accessible objects must only be created for the focused or queried items,
+ *          and only when an assistive technology client is active
+ */
+TEST_F(AccessibilityTests, OnDemand)
+{
+    MasterScore* score = ScoreRW::readScore(ACCESSIBILITY_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    EXPECT_EQ(accessibleCount(score), 0u);
+
+    Chord* chord = score->firstMeasure()->findChord(Fraction(0, 1), 0);
+    ASSERT_TRUE(chord);
+    Note* note = chord->upNote();
+
+    // no client, nothing is created
+    note->setSelected(true);
+    EXPECT_FALSE(note->accessible());
+    EXPECT_EQ(accessibleCount(score), 0u);
+    note->setSelected(false);
+
+    // focus creates the object of the focused item and of the root only
+    s_controller->active = true;
+    note->setSelected(true);
+    ASSERT_TRUE(note->hasAccessible());
+    EXPECT_TRUE(note->accessible()->registered());
+    EXPECT_TRUE(score->rootItem()->hasAccessible());
+    EXPECT_EQ(accessibleCount(score), 1u);
+
+    // querying the children creates the objects of the children
+    const size_t childCount = chord->accessible()->accessibleChildCount();
+    EXPECT_GT(childCount, 0u);
+    EXPECT_EQ(accessibleCount(score), 2u + childCount - 1);
+
+    delete score;
+}
+
+/**
+ * @brief AccessibilityTests_DISABLED_MemoryBenchmark
+ * @details Resident memory of a long score with the accessible objects created on demand,
+ *          and after they have been created for every item (as with an active client).
+ *          No accessible object may exist before the items are queried
+ */
+TEST_F(AccessibilityTests, DISABLED_MemoryBenchmark)
+{
+    const long before = Benchmark::currentRssKb();
+
+    MasterScore* score = ScoreRW::readScore(ACCESSIBILITY_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    score->startCmd();
+    score->appendMeasures(2000 - score->nmeasures());
+    score->endCmd();
+
+    const long onDemand = Benchmark::currentRssKb();
+    EXPECT_EQ(accessibleCount(score), 0u);
+
+    s_controller->active = true;
+    size_t created = 0;
+    for (EngravingItem* e : allItems(score)) {
+        if (e->accessible()) {
+            ++created;
+        }
+    }
+
+    const long all = Benchmark::currentRssKb();
+    EXPECT_GT(created, 0u);
+    EXPECT_EQ(accessibleCount(score), created);
+
+    const std::string name = std::to_string(score->nmeasures()) + " measures";
+    Benchmark::report(name + ", on demand", onDemand - before, "kB");
+    Benchmark::report(name + ", " + std::to_string(created) + " accessible", all - before, "kB");
+
+    delete score;
+}
@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/factory.h"
+#include "libmscore/text.h"
+#include "libmscore/system.h"
+#include "compat/dummyelement.h"
+
+#include "utils/scorerw.h"
+#include "utils/benchmark.h"
+
+static const QString ENGRAVINGOBJECT_DATA_DIR("all_elements_data/");
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class EngravingObjectTests : public ::testing::Test
+{
+public:
+    //! NOTE The children of the given parent which are in the given set, in the order of children()
+    std::vector<EngravingObject*> childrenOf(const EngravingObject* parent, const std::vector<EngravingObject*>& among)
+    {
+        std::vector<EngravingObject*> result;
+        for (EngravingObject* ch : parent->children()) {
+            if (std::find(among.begin(), among.end(), ch) != among.end()) {
+                result.push_back(ch);
+            }
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief EngravingObjectTests_Children
+ * @details Re-parenting and deleting objects must keep the children lists consistent and in insertion order
+ */
+TEST_F(EngravingObjectTests, Children)
+{
+    MasterScore* score = ScoreRW::readScore(ENGRAVINGOBJECT_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m1 = score->firstMeasure();
+    Measure* m2 = m1->nextMeasure();
+    ASSERT_TRUE(m2);
+
+    const size_t m1Count = m1->children().size();
+
+    std::vector<EngravingObject*> texts;
+    for (int i = 0; i < 5; ++i) {
+        texts.push_back(Factory::createText(m1));
+    }
+    EXPECT_EQ(m1->children().size(), m1Count + 5);
+    EXPECT_EQ(m1->children().back(), texts.back());
+    EXPECT_EQ(childrenOf(m1, texts), texts);
+
+    // re-parent from the middle
+    texts[2]->setParent(m2);
+    EXPECT_EQ(m1->children().size(), m1Count + 4);
+    EXPECT_EQ(childrenOf(m1, texts), std::vector<EngravingObject*>({ texts[0], texts[1], texts[3], texts[4] }));
+    EXPECT_EQ(m2->children().back(), texts[2]);
+
+    // re-parent the first and the last
+    texts[0]->setParent(m2);
+    texts[4]->setParent(m2);
+    EXPECT_EQ(childrenOf(m1, texts), std::vector<EngravingObject*>({ texts[1], texts[3] }));
+    EXPECT_EQ(childrenOf(m2, texts), std::vector<EngravingObject*>({ texts[2], texts[0], texts[4] }));
+
+    // the children of a deleted object are moved to the dummy
+    Text* child = Factory::createText(static_cast<Text*>(texts[1]));
+    EXPECT_EQ(texts[1]->children().size(), 1u);
+    delete texts[1];
+    EXPECT_EQ(child->parent(true), score->dummy());
+    EXPECT_EQ(score->dummy()->children().back(), child);
+
+    EXPECT_EQ(childrenOf(m1, texts), std::vector<EngravingObject*>({ texts[3] }));
+    EXPECT_EQ(m1->children().size(), m1Count + 1);
+
+    for (EngravingObject* t : { texts[0], texts[2], texts[3], texts[4] }) {
+        delete t;
+    }
+    delete child;
+
+    EXPECT_EQ(m1->children().size(), m1Count);
+    EXPECT_EQ(childrenOf(m2, texts), std::vector<EngravingObject*>());
+
+    delete score;
+}
+
+/**
+ * @brief EngravingObjectTests_DISABLED_LayoutBenchmark
+ * @details Full layout of a 2000 measure score, which re-parents every measure and system.
+ *          Every measure must end up exactly once in the children of its system,
+ *          and the layouts must not leave objects behind in the dummy
+ */
+TEST_F(EngravingObjectTests, DISABLED_LayoutBenchmark)
+{
+    MasterScore* score = ScoreRW::readScore(ENGRAVINGOBJECT_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    score->startCmd();
+    score->appendMeasures(2000 - score->nmeasures());
+    score->endCmd();
+
+    score->doLayout();
+    const size_t dummyChildren = score->dummy()->children().size();
+
+    const double ms = Benchmark::medianMs([score]() {
+        score->doLayout();
+    });
+
+    EXPECT_EQ(score->dummy()->children().size(), dummyChildren);
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        System* system = m->system();
+        ASSERT_TRUE(system);
+
+        const EngravingObjectList& children = system->children();
+        EXPECT_EQ(std::count(children.begin(), children.end(), m), 1);
+        EXPECT_EQ(static_cast<size_t>(std::distance(children.begin(), children.end())), children.size());
+    }
+
+    Benchmark::report("Layout of " + std::to_string(score->nmeasures()) + " measures", ms, "ms");
+
+    delete score;
+}
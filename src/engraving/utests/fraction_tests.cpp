@@ -0,0 +1,229 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "libmscore/fraction.h"
+
+#include "utils/benchmark.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+//---------------------------------------------------------
+//   Reference implementation: the plain gcd based
+//   arithmetic, without any of the fast paths
+//---------------------------------------------------------
+
+namespace {
+struct RefFraction {
+    int_least64_t n = 0;
+    int_least64_t d = 1;
+};
+
+int_least64_t refGcd(int_least64_t a, int_least64_t b)
+{
+    while (b != 0) {
+        int_least64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a >= 0 ? a : -a;
+}
+
+RefFraction refAdd(RefFraction a, const RefFraction& b)
+{
+    if (a.d == b.d) {
+        a.n += b.n;
+    } else {
+        const int_least64_t g = refGcd(a.d, b.d);
+        const int_least64_t m1 = b.d / g;
+        a.n = a.n * m1 + b.n * (a.d / g);
+        a.d = m1 * a.d;
+    }
+    return a;
+}
+
+RefFraction refSub(RefFraction a, const RefFraction& b)
+{
+    return refAdd(a, RefFraction { -b.n, b.d });
+}
+
+RefFraction refReduced(const RefFraction& a)
+{
+    const int_least64_t g = refGcd(a.n, a.d);
+    return RefFraction { a.n / g, a.d / g };
+}
+
+bool refLess(const RefFraction& a, const RefFraction& b)
+{
+    return a.n * b.d < b.n * a.d;
+}
+
+bool refEqual(const RefFraction& a, const RefFraction& b)
+{
+    return a.n * b.d == b.n * a.d;
+}
+
+RefFraction toRef(const Fraction& f)
+{
+    return RefFraction { f.numerator(), f.denominator() };
+}
+
+bool isIdentical(const Fraction& f, const RefFraction& r)
+{
+    return f.numerator() == r.n && f.denominator() == r.d;
+}
+}
+
+class FractionTests : public ::testing::Test
+{
+protected:
+    //! NOTE Denominators as they occur in scores: powers of two, tuplets and ticks
+    Fraction randomFraction()
+    {
+        static const std::vector<int> denominators { 1, 2, 3, 4, 5, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, 480, 1920 };
+        std::uniform_int_distribution<int> numDist(-4000, 4000);
+        std::uniform_int_distribution<size_t> denDist(0, denominators.size() - 1);
+        std::uniform_int_distribution<int> anyDenDist(1, 1000);
+
+        const int n = numDist(m_random);
+        const int d = (n % 5 == 0) ? anyDenDist(m_random) : denominators.at(denDist(m_random));
+        return Fraction(n, d);
+    }
+
+    std::mt19937 m_random { 20211019 };
+};
+
+/**
+ * @brief FractionTests_Arithmetic
+ * @details Results of += and -= must be identical (same numerator and denominator,
+ *          not just the same value) to the plain gcd based arithmetic
+ */
+TEST_F(FractionTests, Arithmetic)
+{
+    for (int i = 0; i < 100000; ++i) {
+        const Fraction a = randomFraction();
+        const Fraction b = randomFraction();
+
+        EXPECT_TRUE(isIdentical(a + b, refAdd(toRef(a), toRef(b)))) << a.print().toStdString() << " + " << b.print().toStdString();
+        EXPECT_TRUE(isIdentical(a - b, refSub(toRef(a), toRef(b)))) << a.print().toStdString() << " - " << b.print().toStdString();
+    }
+}
+
+/**
+ * @brief FractionTests_Reduction
+ * @details reduced() and fromTicks() must give the same results as reducing by gcd
+ */
+TEST_F(FractionTests, Reduction)
+{
+    for (int i = 0; i < 100000; ++i) {
+        const Fraction a = randomFraction();
+        EXPECT_TRUE(isIdentical(a.reduced(), refReduced(toRef(a)))) << a.print().toStdString();
+
+        Fraction b = a;
+        b.reduce();
+        EXPECT_TRUE(b.identical(a.reduced())) << a.print().toStdString();
+    }
+
+    const int wholeTicks = MScore::division * 4;
+    for (int ticks = -4 * wholeTicks; ticks <= 4 * wholeTicks; ++ticks) {
+        if (ticks == -1) {
+            continue;               // see Fraction::fromTicks
+        }
+        EXPECT_TRUE(isIdentical(Fraction::fromTicks(ticks), refReduced(RefFraction { ticks, wholeTicks }))) << ticks;
+        if (ticks >= 0) {
+            EXPECT_EQ(Fraction::fromTicks(ticks).ticks(), ticks);
+        }
+    }
+}
+
+/**
+ * @brief FractionTests_Comparison
+ * @details Comparison operators must agree with each other and with the reference
+ */
+TEST_F(FractionTests, Comparison)
+{
+    for (int i = 0; i < 100000; ++i) {
+        const Fraction a = randomFraction();
+        const Fraction b = (i % 3 == 0) ? a.reduced() : randomFraction();
+
+        const bool less = refLess(toRef(a), toRef(b));
+        const bool equal = refEqual(toRef(a), toRef(b));
+
+        EXPECT_EQ(a < b, less);
+        EXPECT_EQ(a <= b, less || equal);
+        EXPECT_EQ(a > b, !less && !equal);
+        EXPECT_EQ(a >= b, !less);
+        EXPECT_EQ(a == b, equal);
+        EXPECT_EQ(a != b, !equal);
+    }
+}
+
+/**
+ * @brief FractionTests_DISABLED_Benchmark
+ * @details The typical layout workload: adding durations in ticks and comparing
+ *          positions. The sum telescopes, so it is checked against the ticks
+ */
+TEST_F(FractionTests, DISABLED_Benchmark)
+{
+    constexpr int ROUNDS = 10000;
+
+    std::vector<Fraction> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(Fraction::fromTicks(std::abs(randomFraction().ticks()) % (MScore::division * 16)));
+    }
+
+    int expectedLessCount = 0;
+    for (size_t i = 1; i < values.size(); ++i) {
+        if (values[i - 1].ticks() < values[i].ticks()) {
+            ++expectedLessCount;
+        }
+    }
+
+    Fraction sum(0, 1);
+    int lessCount = 0;
+    const double ms = Benchmark::medianMs([&]() {
+        for (int n = 0; n < ROUNDS; ++n) {
+            for (size_t i = 1; i < values.size(); ++i) {
+                sum += values[i];
+                sum -= values[i - 1];
+                if (values[i - 1] < values[i]) {
+                    ++lessCount;
+                }
+                sum = Fraction::fromTicks(sum.ticks());
+            }
+        }
+    }, 5, [&]() {
+        sum = Fraction(0, 1);
+        lessCount = 0;
+    });
+
+    EXPECT_EQ(sum, Fraction::fromTicks(ROUNDS * (values.back().ticks() - values.front().ticks())));
+    EXPECT_EQ(lessCount, ROUNDS * expectedLessCount);
+
+    Benchmark::report("Fraction add/compare", ms, "ms");
+}
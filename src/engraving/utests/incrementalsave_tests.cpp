@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QBuffer>
+
+#include "compat/writescorehook.h"
+#include "compat/scoreaccess.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/excerpt.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/chord.h"
+#include "libmscore/note.h"
+#include "libmscore/instrtemplate.h"
+#include "libmscore/undo.h"
+#include "rw/measurewritecache.h"
+
+#include "utils/scorerw.h"
+#include "utils/benchmark.h"
+
+static const QString IMPLODE_EXPLODE_DATA_DIR("implode_explode_data/");
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class IncrementalSaveTests : public ::testing::Test
+{
+public:
+    //! NOTE The master score followed by the parts, as they are written to the mscz
+    std::vector<QByteArray> writeScores(MasterScore* score, bool incremental)
+    {
+        score->setIncrementalSaveEnabled(incremental);
+
+        std::vector<Score*> scores { score };
+        for (const Excerpt* excerpt : score->excerpts()) {
+            scores.push_back(excerpt->partScore());
+        }
+
+        std::vector<QByteArray> result;
+        for (Score* s : scores) {
+            QByteArray data;
+            QBuffer buffer(&data);
+            buffer.open(QIODevice::ReadWrite);
+
+            compat::WriteScoreHook hook;
+            s->writeScore(&buffer, false, false, hook);
+            result.push_back(data);
+        }
+
+        return result;
+    }
+
+    size_t cacheHits(MasterScore* score)
+    {
+        size_t hits = 0;
+        for (Score* s : score->scoreList()) {
+            if (s->measureWriteCache()) {
+                hits += s->measureWriteCache()->hits();
+            }
+        }
+        return hits;
+    }
+
+    //! NOTE A flute part per staff, with quarter notes in every measure of every staff
+    MasterScore* createScore(int partsCount, int measuresCount)
+    {
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        score->sigmap()->add(0, Fraction(4, 4));
+
+        const InstrumentTemplate* flute = searchTemplate("flute");
+        EXPECT_TRUE(flute);
+        if (!flute) {
+            return score;
+        }
+
+        score->startCmd();
+        for (int i = 0; i < partsCount; ++i) {
+            score->appendPart(flute);
+        }
+        score->appendMeasures(measuresCount);
+
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            for (int staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+                Segment* s = m->first(SegmentType::ChordRest);
+                for (int beat = 0; beat < 4 && s; ++beat) {
+                    NoteVal nval(72 + (staffIdx + m->no() + beat) % 12);
+                    s = score->setNoteRest(s, staffIdx * VOICES, nval, Fraction(1, 4));
+                    s = s ? s->next(SegmentType::ChordRest) : nullptr;
+                }
+            }
+        }
+        score->endCmd();
+
+        return score;
+    }
+
+    void changePitch(MasterScore* score)
+    {
+        Chord* chord = score->firstMeasure()->findChord(Fraction(0, 1), 0);
+        ASSERT_TRUE(chord);
+
+        Note* note = chord->upNote();
+        score->startCmd();
+        note->undoChangeProperty(Pid::PITCH, note->pitch() + 2);
+        score->endCmd();
+    }
+};
+
+/**
+ * @brief IncrementalSaveTests_Equivalence
+ * @details An incremental save (after an edit and after undo) must write
+ *          exactly what a full save writes
+ */
+TEST_F(IncrementalSaveTests, Equivalence)
+{
+    MasterScore* score = ScoreRW::readScore(IMPLODE_EXPLODE_DATA_DIR + "explode1.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().empty());
+
+    // fill the cache, nothing changed since
+    writeScores(score, true);
+    std::vector<QByteArray> incremental = writeScores(score, true);
+    EXPECT_EQ(incremental, writeScores(score, false));
+
+    // edit
+    writeScores(score, true);
+    changePitch(score);
+    incremental = writeScores(score, true);
+    EXPECT_GT(cacheHits(score), 0u);
+    EXPECT_EQ(incremental, writeScores(score, false));
+
+    // undo
+    writeScores(score, true);
+    EditData ed;
+    score->undoRedo(true, &ed);
+    incremental = writeScores(score, true);
+    EXPECT_EQ(incremental, writeScores(score, false));
+
+    // redo with the undo stack alone, the commands themselves drop what they change
+    writeScores(score, true);
+    score->undoStack()->redo(&ed);
+    incremental = writeScores(score, true);
+    EXPECT_EQ(incremental, writeScores(score, false));
+
+    delete score;
+}
+
+/**
+ * @brief IncrementalSaveTests_DISABLED_Benchmark
+ * @details Save time of a score with 20 parts after an edit of a single note,
+ *          full and incremental. Both saves must write the same data
+ */
+TEST_F(IncrementalSaveTests, DISABLED_Benchmark)
+{
+    MasterScore* score = createScore(20, 100);
+    ASSERT_EQ(score->parts().size(), 20);
+    ASSERT_EQ(score->nmeasures(), 100);
+
+    score->startCmd();
+    for (Excerpt* excerpt : Excerpt::createExcerptsFromParts(score->parts())) {
+        score->initAndAddExcerpt(excerpt, false);
+    }
+    score->endCmd();
+    ASSERT_EQ(score->excerpts().size(), 20);
+
+    std::vector<QByteArray> full;
+    const double fullMs = Benchmark::medianMs([&]() {
+        full = writeScores(score, false);
+    }, 5, [this, score]() {
+        changePitch(score);
+    });
+
+    std::vector<QByteArray> incremental;
+    const double incrementalMs = Benchmark::medianMs([&]() {
+        incremental = writeScores(score, true);
+    }, 5, [this, score]() {
+        writeScores(score, true);
+        changePitch(score);
+    });
+
+    EXPECT_EQ(full.size(), 21u);
+    EXPECT_GT(cacheHits(score), 0u);
+    EXPECT_EQ(incremental, writeScores(score, false));
+
+    Benchmark::report("Full save after a note edit", fullMs, "ms");
+    Benchmark::report("Incremental save after a note edit", incrementalMs, "ms");
+
+    delete score;
+}
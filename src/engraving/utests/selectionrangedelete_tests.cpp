@@ -22,12 +22,18 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
+
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/chord.h"
+#include "libmscore/note.h"
 #include "libmscore/undo.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
+#include "utils/benchmark.h"
 
 static const QString SELRANGEDELETE_DATA_DIR("selectionrangedelete_data/");
 
@@ -201,3 +207,129 @@ TEST_F(SelectionRangeDeleteTests, deleteSkipAnnotations)
                                             SELRANGEDELETE_DATA_DIR + QString("selectionrangedelete05-ref.mscx")));
     delete score;
 }
+
+TEST_F(SelectionRangeDeleteTests, listSelectionAddRemove)
+{
+    MasterScore* score = ScoreRW::readScore("all_elements_data/moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    std::vector<Note*> notes;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s && notes.size() < 5; s = s->next1(SegmentType::ChordRest)) {
+        EngravingItem* e = s->element(0);
+        if (e && e->isChord()) {
+            notes.push_back(toChord(e)->upNote());
+        }
+    }
+    ASSERT_EQ(notes.size(), 5u);
+
+    score->select(notes[0], SelectType::SINGLE);
+    for (size_t i = 1; i < notes.size(); ++i) {
+        score->select(notes[i], SelectType::ADD);
+    }
+    score->select(notes[2], SelectType::ADD);     // already selected
+    EXPECT_TRUE(score->selection().isList());
+    EXPECT_EQ(score->selection().elements().size(), 5);
+
+    score->deselect(notes[1]);
+    score->deselect(notes[3]);
+    EXPECT_FALSE(notes[1]->selected());
+    EXPECT_FALSE(score->selection().contains(notes[3]));
+    EXPECT_TRUE(score->selection().contains(notes[4]));
+    EXPECT_EQ(score->selection().elements(), QList<EngravingItem*>({ notes[0], notes[2], notes[4] }));
+
+    // re-added elements go to the end
+    score->select(notes[1], SelectType::ADD);
+    EXPECT_EQ(score->selection().elements(), QList<EngravingItem*>({ notes[0], notes[2], notes[4], notes[1] }));
+
+    score->deselect(notes[0]);
+    score->deselect(notes[2]);
+    score->deselect(notes[4]);
+    EXPECT_TRUE(score->selection().isSingle());
+    EXPECT_EQ(score->selection().element(), notes[1]);
+
+    score->deselect(notes[1]);
+    EXPECT_TRUE(score->selection().isNone());
+    EXPECT_TRUE(score->selection().elements().empty());
+
+    delete score;
+}
+
+/**
+ * @brief SelectionRangeDeleteTests_DISABLED_benchmarkSelectAllAndDelete
+ * @details Select all and delete on a long score, as a range and as a list of all the notes.
+ *          Both must delete every note, and undo must bring them all back
+ */
+TEST_F(SelectionRangeDeleteTests, DISABLED_benchmarkSelectAllAndDelete)
+{
+    MasterScore* score = ScoreRW::readScore("all_elements_data/moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    // a long score with a note in every measure
+    const int measures = score->nmeasures();
+    score->startCmd();
+    score->appendMeasures(2000 - measures);
+    score->endCmd();
+
+    score->startCmd();
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (m->no() >= measures) {
+            score->setNoteRest(m->first(SegmentType::ChordRest), 0, NoteVal(60), m->ticks());
+        }
+    }
+    score->endCmd();
+
+    auto noteCount = [score]() {
+        size_t count = 0;
+        for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+            for (int track = 0; track < score->ntracks(); ++track) {
+                EngravingItem* e = s->element(track);
+                if (e && e->isChord()) {
+                    count += toChord(e)->notes().size();
+                }
+            }
+        }
+        return count;
+    };
+
+    const size_t notes = noteCount();
+    ASSERT_GT(notes, 0u);
+
+    auto deleteSelection = [score, notes, &noteCount](const std::function<void()>& select) {
+        bool deleted = false;
+        const double ms = Benchmark::medianMs([score]() {
+            score->startCmd();
+            score->cmdDeleteSelection();
+            score->endCmd();
+        }, 3, [score, &deleted, &select]() {
+            if (deleted) {
+                score->undoRedo(true, 0);
+            }
+            deleted = true;
+            select();
+        });
+
+        EXPECT_EQ(noteCount(), 0u);
+        score->undoRedo(true, 0);
+        EXPECT_EQ(noteCount(), notes);
+
+        return ms;
+    };
+
+    const double range = deleteSelection([score]() {
+        score->cmdSelectAll();
+    });
+
+    size_t selected = 0;
+    const double list = deleteSelection([score, &selected]() {
+        Chord* chord = score->firstMeasure()->findChord(Fraction(0, 1), 0);
+        score->selectSimilar(chord->upNote(), false);
+        selected = score->selection().elements().size();
+    });
+    EXPECT_GE(selected, notes);
+
+    const std::string name = "Select all and delete, " + std::to_string(score->nmeasures()) + " measures";
+    Benchmark::report(name + ", range", range, "ms");
+    Benchmark::report(name + ", list of " + std::to_string(selected) + " notes", list, "ms");
+
+    delete score;
+}
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+using namespace mu::engraving;
+
+double Benchmark::medianMs(const std::function<void()>& func, int runs, const std::function<void()>& prepare)
+{
+    std::vector<double> times;
+    for (int i = 0; i < runs; ++i) {
+        if (prepare) {
+            prepare();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    if (times.empty()) {
+        return 0.0;
+    }
+
+    std::sort(times.begin(), times.end());
+    return times.at(times.size() / 2);
+}
+
+long Benchmark::currentRssKb()
+{
+#ifdef Q_OS_LINUX
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (!(statm >> size >> resident)) {
+        return -1;
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return -1;
+#endif
+}
+
+void Benchmark::report(const std::string& key, double value, const std::string& unit)
+{
+    std::ostringstream text;
+    text << value << " " << unit;
+
+    std::cout << "[ BENCHMARK ] " << key << ": " << text.str() << std::endl;
+    ::testing::Test::RecordProperty(key, text.str());
+}
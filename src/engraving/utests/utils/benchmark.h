@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_BENCHMARK_H
+#define MU_ENGRAVING_BENCHMARK_H
+
+#include <functional>
+#include <string>
+
+namespace mu::engraving {
+//! NOTE Helpers of the disabled benchmark tests, run them with --gtest_also_run_disabled_tests.
+//! The benchmarks still assert the behaviour they measure, the numbers are only reported
+class Benchmark
+{
+public:
+    //! NOTE Median wall time of the runs, in ms. The prepare function is called before every run and is not timed
+    static double medianMs(const std::function<void()>& func, int runs = 5, const std::function<void()>& prepare = nullptr);
+
+    //! NOTE Resident set size of the process in kB, -1 if unknown (Linux only)
+    static long currentRssKb();
+
+    //! NOTE Prints the value and records it as a property of the test (in the xml output)
+    static void report(const std::string& key, double value, const std::string& unit);
+};
+}
+
+#endif // MU_ENGRAVING_BENCHMARK_H
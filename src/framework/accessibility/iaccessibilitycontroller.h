@@ -35,6 +35,9 @@ public:
 
     virtual const IAccessible* accessibleRoot() const = 0;
 
+    //! NOTE Whether an assistive technology client (e.g. a screen reader) is connected
+    virtual bool isActive() const = 0;
+
     virtual void reg(IAccessible* item) = 0;
     virtual void unreg(IAccessible* item) = 0;
 };
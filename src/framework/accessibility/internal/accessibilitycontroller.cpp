@@ -83,6 +83,11 @@ const IAccessible* AccessibilityController::accessibleRoot() const
     return this;
 }
 
+bool AccessibilityController::isActive() const
+{
+    return QAccessible::isActive();
+}
+
 void AccessibilityController::reg(IAccessible* item)
 {
     if (!m_inited) {
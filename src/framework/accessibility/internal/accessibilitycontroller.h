@@ -57,6 +57,7 @@ public:
 
     // IAccessibilityController
     const IAccessible* accessibleRoot() const override;
+    bool isActive() const override;
 
     void reg(IAccessible* item) override;
     void unreg(IAccessible* item) override;
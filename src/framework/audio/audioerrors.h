@@ -59,6 +59,14 @@ enum class Err {
 
     // clock
     InvalidTimeLoop = 350,
+
+    // soundtrack
+    UnknownSoundTrackFormat = 360,
+    SoundTrackOpenFailed = 361,
+    SoundTrackWriteFailed = 362,
+    SoundTrackRenderTimeout = 363,
+    SoundTrackRenderAborted = 364,
+    SoundTrackRenderBusy = 365,
 };
 
 inline Ret make_ret(Err e)
@@ -44,6 +44,7 @@
 
 #include "view/synthssettingsmodel.h"
 #include "devtools/waveformmodel.h"
+#include "devtools/audiotelemetrymodel.h"
 
 #include "diagnostics/idiagnosticspathsregister.h"
 
@@ -119,6 +120,7 @@ void AudioModule::registerResources()
 void AudioModule::registerUiTypes()
 {
     qmlRegisterType<WaveFormModel>("MuseScore.Audio", 1, 0, "WaveFormModel");
+    qmlRegisterType<AudioTelemetryModel>("MuseScore.Audio", 1, 0, "AudioTelemetryModel");
     qmlRegisterType<synth::SynthsSettingsModel>("MuseScore.Audio", 1, 0, "SynthsSettingsModel");
 
     ioc()->resolve<ui::IUiEngine>(moduleName())->addSourceImportPath(audio_QML_IMPORT);
@@ -27,6 +27,8 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
+#include <cstdint>
 
 #include "realfn.h"
 #include "midi/miditypes.h"
@@ -255,6 +257,22 @@ private:
     std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
 };
 
+struct AudioProcessingStats {
+    std::string name;
+    uint64_t blockCount = 0;
+    uint64_t deadlineMissCount = 0; //! NOTE Blocks processed slower than real time
+    uint64_t totalTimeUs = 0;
+    uint64_t maxTimeUs = 0;
+    std::vector<uint64_t> histogram; //! NOTE Block counts per AudioTelemetryData::histogramBoundsUs
+};
+
+struct AudioTelemetryData {
+    std::vector<uint64_t> histogramBoundsUs; //! NOTE Upper bounds of the block time buckets, the last bucket is unbounded
+    std::vector<AudioProcessingStats> stages;
+    uint64_t bufferUnderrunCount = 0;
+    uint64_t driverXrunCount = 0;
+};
+
 using PlaybackData = std::variant<midi::MidiData, io::Device*>;
 
 enum class PlaybackStatus {
@@ -262,6 +280,40 @@ enum class PlaybackStatus {
     Paused,
     Running
 };
+
+enum class RenderMode {
+    RealTimeMode = 0,
+    OfflineMode
+};
+
+enum class SoundTrackType {
+    Undefined = -1,
+    WAV,
+    FLAC,
+    OGG,
+    MP3
+};
+
+struct SoundTrackFormat {
+    SoundTrackType type = SoundTrackType::Undefined;
+    unsigned int sampleRate = 0;
+    int bitRate = 0; //! NOTE kbit/s, only for MP3
+    double quality = 0.; //! NOTE From 0 to 1, only for OGG
+
+    bool isValid() const
+    {
+        return type != SoundTrackType::Undefined
+               && sampleRate != 0;
+    }
+};
+
+//! NOTE A part of the mix written into its own file. The stem without tracks is the whole mix
+struct SoundTrackStem {
+    io::path destination;
+    TrackIdList trackIds;
+};
+
+using SoundTrackStemList = std::vector<SoundTrackStem>;
 }
 
 #endif // MU_AUDIO_AUDIOTYPES_H
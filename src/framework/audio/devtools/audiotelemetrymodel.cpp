@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "audiotelemetrymodel.h"
+
+#include <QStringList>
+
+using namespace mu::audio;
+
+static constexpr int UPDATE_INTERVAL_MS = 500;
+
+AudioTelemetryModel::AudioTelemetryModel(QObject* parent)
+    : QObject(parent)
+{
+    m_updateTimer.setInterval(UPDATE_INTERVAL_MS);
+    connect(&m_updateTimer, &QTimer::timeout, this, &AudioTelemetryModel::update);
+    m_updateTimer.start();
+
+    update();
+}
+
+QVariantList AudioTelemetryModel::stages() const
+{
+    QVariantList result;
+
+    for (const AudioProcessingStats& stage : m_data.stages) {
+        QStringList histogram;
+        for (uint64_t count : stage.histogram) {
+            histogram << QString::number(count);
+        }
+
+        QVariantMap item;
+        item["name"] = QString::fromStdString(stage.name);
+        item["blockCount"] = QVariant::fromValue(stage.blockCount);
+        item["deadlineMissCount"] = QVariant::fromValue(stage.deadlineMissCount);
+        item["avgTimeUs"] = QVariant::fromValue(stage.blockCount ? stage.totalTimeUs / stage.blockCount : 0);
+        item["maxTimeUs"] = QVariant::fromValue(stage.maxTimeUs);
+        item["histogram"] = histogram.join(" | ");
+
+        result << item;
+    }
+
+    return result;
+}
+
+QString AudioTelemetryModel::histogramTitle() const
+{
+    QStringList bounds;
+    for (uint64_t bound : m_data.histogramBoundsUs) {
+        bounds << "<" + QString::number(bound);
+    }
+    bounds << ">=" + QString::number(m_data.histogramBoundsUs.empty() ? 0 : m_data.histogramBoundsUs.back());
+
+    return bounds.join(" | ") + " us";
+}
+
+int AudioTelemetryModel::bufferUnderrunCount() const
+{
+    return static_cast<int>(m_data.bufferUnderrunCount);
+}
+
+int AudioTelemetryModel::driverXrunCount() const
+{
+    return static_cast<int>(m_data.driverXrunCount);
+}
+
+void AudioTelemetryModel::reset()
+{
+    configuration()->resetTelemetryData();
+    update();
+}
+
+void AudioTelemetryModel::update()
+{
+    m_data = configuration()->telemetryData();
+    emit dataChanged();
+}
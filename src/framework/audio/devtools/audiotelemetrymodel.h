@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_AUDIOTELEMETRYMODEL_H
+#define MU_AUDIO_AUDIOTELEMETRYMODEL_H
+
+#include <QObject>
+#include <QTimer>
+#include <QVariantList>
+
+#include "modularity/ioc.h"
+
+#include "iaudioconfiguration.h"
+
+namespace mu::audio {
+class AudioTelemetryModel : public QObject
+{
+    Q_OBJECT
+
+    INJECT(audio, IAudioConfiguration, configuration)
+
+    Q_PROPERTY(QVariantList stages READ stages NOTIFY dataChanged)
+    Q_PROPERTY(QString histogramTitle READ histogramTitle NOTIFY dataChanged)
+    Q_PROPERTY(int bufferUnderrunCount READ bufferUnderrunCount NOTIFY dataChanged)
+    Q_PROPERTY(int driverXrunCount READ driverXrunCount NOTIFY dataChanged)
+
+public:
+    explicit AudioTelemetryModel(QObject* parent = nullptr);
+
+    QVariantList stages() const;
+    QString histogramTitle() const;
+    int bufferUnderrunCount() const;
+    int driverXrunCount() const;
+
+    Q_INVOKABLE void reset();
+
+signals:
+    void dataChanged();
+
+private:
+    void update();
+
+    QTimer m_updateTimer;
+    AudioTelemetryData m_data;
+};
+}
+
+#endif // MU_AUDIO_AUDIOTELEMETRYMODEL_H
@@ -58,6 +58,10 @@ public:
     virtual Ret saveSynthesizerState(const synth::SynthesizerState& state) = 0;
     virtual async::Notification synthesizerStateChanged() const = 0;
     virtual async::Notification synthesizerStateGroupChanged(const std::string& groupName) const = 0;
+
+    // diagnostics
+    virtual AudioTelemetryData telemetryData() const = 0;
+    virtual void resetTelemetryData() = 0;
 };
 }
 
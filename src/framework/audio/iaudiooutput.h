@@ -27,6 +27,7 @@
 
 #include "async/promise.h"
 #include "async/channel.h"
+#include "global/progress.h"
 
 #include "audiotypes.h"
 
@@ -48,6 +49,15 @@ public:
 
     virtual async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
     virtual async::Promise<AudioSignalChanges> masterSignalChanges() const = 0;
+
+    //! NOTE Renders the whole sequence offline, as fast as possible, and encodes it into the destination file
+    virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path& destination,
+                                                const SoundTrackFormat& format) = 0;
+    //! NOTE Renders the sequence once and writes the output of the stem tracks into each stem file
+    virtual async::Promise<bool> saveSoundTrackStems(const TrackSequenceId sequenceId, const SoundTrackStemList& stems,
+                                                     const SoundTrackFormat& format) = 0;
+    virtual void abortSavingAllSoundTracks() = 0;
+    virtual framework::ProgressChannel saveSoundTrackProgress() const = 0;
 };
 
 using IAudioOutputPtr = std::shared_ptr<IAudioOutput>;
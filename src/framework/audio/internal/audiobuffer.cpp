@@ -22,9 +22,12 @@
 #include "audiobuffer.h"
 
 #include <cstring>
+#include <algorithm>
 
 #include "log.h"
 
+#include "audiotelemetry.h"
+
 using namespace mu::audio;
 
 void AudioBuffer::init(const audioch_t audioChannelsCount, const samples_t samplesPerChannel)
@@ -41,6 +44,11 @@ void AudioBuffer::setSource(std::shared_ptr<IAudioSource> source)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_source = source;
+
+    //! NOTE Without a source the driver keeps reading the ring, so it must not replay the old data
+    if (!m_source) {
+        std::fill(m_data.begin(), m_data.end(), 0.f);
+    }
 }
 
 void AudioBuffer::forward()
@@ -53,6 +61,11 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
+    //! NOTE The worker has not produced enough samples, the driver gets stale data
+    if (m_source && sampleLag() < sampleCount) {
+        AudioTelemetry::addBufferUnderrun();
+    }
+
     size_t from = m_readIndex;
     auto memStep = sizeof(float);
     size_t to = m_readIndex + sampleCount * m_audioChannelsCount;
@@ -28,6 +28,8 @@
 
 #include "log.h"
 
+#include "audiotelemetry.h"
+
 //TODO: remove with global clearing of Q_OS_*** defines
 #include <QtGlobal>
 
@@ -199,6 +201,16 @@ async::Notification AudioConfiguration::synthesizerStateGroupChanged(const std::
     return m_synthesizerStateGroupChanged[gname];
 }
 
+AudioTelemetryData AudioConfiguration::telemetryData() const
+{
+    return AudioTelemetry::data();
+}
+
+void AudioConfiguration::resetTelemetryData()
+{
+    AudioTelemetry::reset();
+}
+
 io::path AudioConfiguration::stateFilePath() const
 {
     return globalConfiguration()->userAppDataPath() + "/synthesizer.xml";
@@ -57,6 +57,9 @@ public:
     async::Notification synthesizerStateChanged() const override;
     async::Notification synthesizerStateGroupChanged(const std::string& groupName) const override;
 
+    AudioTelemetryData telemetryData() const override;
+    void resetTelemetryData() override;
+
 private:
     async::Channel<io::paths> m_soundFontDirsChanged;
 
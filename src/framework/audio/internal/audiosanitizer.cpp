@@ -27,6 +27,7 @@ using namespace mu::audio;
 
 static std::thread::id s_as_mainThreadID;
 static std::thread::id s_as_workerThreadID;
+static thread_local bool s_as_isWorkerHelperThread = false;
 
 void AudioSanitizer::setupMainThread()
 {
@@ -57,3 +58,13 @@ bool AudioSanitizer::isWorkerThread()
 {
     return std::this_thread::get_id() == s_as_workerThreadID;
 }
+
+void AudioSanitizer::setupWorkerHelperThread()
+{
+    s_as_isWorkerHelperThread = true;
+}
+
+bool AudioSanitizer::isWorkerHelperThread()
+{
+    return s_as_isWorkerHelperThread;
+}
@@ -0,0 +1,170 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audiotelemetry.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+using namespace mu::audio;
+
+static constexpr size_t MAX_STAGES = 512;
+static constexpr std::array<uint64_t, 9> HISTOGRAM_BOUNDS_US = { 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000 };
+static constexpr size_t HISTOGRAM_SIZE = HISTOGRAM_BOUNDS_US.size() + 1;
+
+namespace {
+struct Stage {
+    std::atomic<bool> used = false;
+    std::string name; //! NOTE Under s_mutex
+
+    std::atomic<uint64_t> blockCount = 0;
+    std::atomic<uint64_t> deadlineMissCount = 0;
+    std::atomic<uint64_t> totalTimeNs = 0;
+    std::atomic<uint64_t> maxTimeNs = 0;
+    std::array<std::atomic<uint64_t>, HISTOGRAM_SIZE> histogram = {};
+
+    void resetCounters()
+    {
+        blockCount.store(0, std::memory_order_relaxed);
+        deadlineMissCount.store(0, std::memory_order_relaxed);
+        totalTimeNs.store(0, std::memory_order_relaxed);
+        maxTimeNs.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t>& count : histogram) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+}
+
+static std::mutex s_mutex;
+static std::array<Stage, MAX_STAGES> s_stages;
+static std::atomic<uint64_t> s_bufferUnderrunCount = 0;
+static std::atomic<uint64_t> s_driverXrunCount = 0;
+
+AudioTelemetry::StageId AudioTelemetry::registerStage(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    for (size_t i = 0; i < s_stages.size(); ++i) {
+        Stage& stage = s_stages[i];
+        if (stage.used.load(std::memory_order_relaxed)) {
+            continue;
+        }
+
+        stage.name = name;
+        stage.resetCounters();
+        stage.used.store(true, std::memory_order_release);
+        return static_cast<StageId>(i);
+    }
+
+    return INVALID_STAGE;
+}
+
+void AudioTelemetry::unregisterStage(StageId stage)
+{
+    if (stage < 0 || static_cast<size_t>(stage) >= s_stages.size()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_stages[stage].used.store(false, std::memory_order_release);
+}
+
+void AudioTelemetry::addBlock(StageId stage, uint64_t timeNs, samples_t samplesPerChannel, unsigned int sampleRate)
+{
+    if (stage < 0 || static_cast<size_t>(stage) >= s_stages.size()) {
+        return;
+    }
+
+    Stage& s = s_stages[stage];
+
+    s.blockCount.fetch_add(1, std::memory_order_relaxed);
+    s.totalTimeNs.fetch_add(timeNs, std::memory_order_relaxed);
+
+    //! NOTE Only the owner thread writes the stage, so there is no need for compare-exchange
+    if (timeNs > s.maxTimeNs.load(std::memory_order_relaxed)) {
+        s.maxTimeNs.store(timeNs, std::memory_order_relaxed);
+    }
+
+    //! NOTE The block took longer than the audio it produces
+    if (sampleRate > 0 && timeNs * sampleRate > static_cast<uint64_t>(samplesPerChannel) * 1000000000) {
+        s.deadlineMissCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const uint64_t timeUs = timeNs / 1000;
+    size_t bucket = 0;
+    while (bucket < HISTOGRAM_BOUNDS_US.size() && timeUs >= HISTOGRAM_BOUNDS_US[bucket]) {
+        ++bucket;
+    }
+    s.histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void AudioTelemetry::addBufferUnderrun()
+{
+    s_bufferUnderrunCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AudioTelemetry::addDriverXrun()
+{
+    s_driverXrunCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+AudioTelemetryData AudioTelemetry::data()
+{
+    AudioTelemetryData result;
+    result.histogramBoundsUs.assign(HISTOGRAM_BOUNDS_US.begin(), HISTOGRAM_BOUNDS_US.end());
+    result.bufferUnderrunCount = s_bufferUnderrunCount.load(std::memory_order_relaxed);
+    result.driverXrunCount = s_driverXrunCount.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    for (const Stage& s : s_stages) {
+        if (!s.used.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        AudioProcessingStats stats;
+        stats.name = s.name;
+        stats.blockCount = s.blockCount.load(std::memory_order_relaxed);
+        stats.deadlineMissCount = s.deadlineMissCount.load(std::memory_order_relaxed);
+        stats.totalTimeUs = s.totalTimeNs.load(std::memory_order_relaxed) / 1000;
+        stats.maxTimeUs = s.maxTimeNs.load(std::memory_order_relaxed) / 1000;
+        for (const std::atomic<uint64_t>& count : s.histogram) {
+            stats.histogram.push_back(count.load(std::memory_order_relaxed));
+        }
+
+        result.stages.push_back(std::move(stats));
+    }
+
+    return result;
+}
+
+void AudioTelemetry::reset()
+{
+    s_bufferUnderrunCount.store(0, std::memory_order_relaxed);
+    s_driverXrunCount.store(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (Stage& s : s_stages) {
+        s.resetCounters();
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUDIOTELEMETRY_H
+#define MU_AUDIO_AUDIOTELEMETRY_H
+
+#include <chrono>
+#include <string>
+
+#include "audiotypes.h"
+
+namespace mu::audio {
+//! NOTE Performance counters of the audio processing.
+//! The counters are written without locks by the audio threads (each stage by one thread)
+//! and are read by the main thread.
+class AudioTelemetry
+{
+public:
+    using StageId = int;
+    static constexpr StageId INVALID_STAGE = -1;
+
+    //! NOTE Takes a lock, do not call it for every block
+    static StageId registerStage(const std::string& name);
+    static void unregisterStage(StageId stage);
+
+    static void addBlock(StageId stage, uint64_t timeNs, samples_t samplesPerChannel, unsigned int sampleRate);
+    static void addBufferUnderrun();
+    static void addDriverXrun();
+
+    static AudioTelemetryData data();
+    static void reset();
+};
+
+//! NOTE Measures the processing time of a block until the end of the scope
+class AudioBlockTimer
+{
+public:
+    AudioBlockTimer(AudioTelemetry::StageId stage, samples_t samplesPerChannel, unsigned int sampleRate)
+        : m_stage(stage), m_samplesPerChannel(samplesPerChannel), m_sampleRate(sampleRate),
+        m_begin(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~AudioBlockTimer()
+    {
+        std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - m_begin;
+        AudioTelemetry::addBlock(m_stage, static_cast<uint64_t>(elapsed.count()), m_samplesPerChannel, m_sampleRate);
+    }
+
+private:
+    AudioTelemetry::StageId m_stage = AudioTelemetry::INVALID_STAGE;
+    samples_t m_samplesPerChannel = 0;
+    unsigned int m_sampleRate = 0;
+    std::chrono::steady_clock::time_point m_begin;
+};
+}
+
+#endif // MU_AUDIO_AUDIOTELEMETRY_H
@@ -33,6 +33,8 @@
 #include "log.h"
 #include "runtime.h"
 
+#include "internal/audiotelemetry.h"
+
 using namespace mu::audio;
 
 namespace  {
@@ -70,6 +72,7 @@ static void* alsaThread(void* aParam)
         snd_pcm_sframes_t pcm = snd_pcm_writei(data->alsaDeviceHandle, data->buffer, data->samples);
         if (pcm != -EPIPE) {
         } else {
+            AudioTelemetry::addDriverXrun();
             snd_pcm_prepare(data->alsaDeviceHandle);
         }
     }
@@ -74,7 +74,7 @@ Ret SanitySynthesizer::removeSoundFonts()
 
 bool SanitySynthesizer::isActive() const
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
     return m_synth->isActive();
 }
 
@@ -92,7 +92,7 @@ Ret SanitySynthesizer::setupMidiChannels(const std::vector<midi::Event>& events)
 
 bool SanitySynthesizer::handleEvent(const midi::Event& e)
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
     return m_synth->handleEvent(e);
 }
 
@@ -141,7 +141,7 @@ void SanitySynthesizer::setSampleRate(unsigned int sampleRate)
 
 unsigned int SanitySynthesizer::audioChannelsCount() const
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
     return m_synth->audioChannelsCount();
 }
 
@@ -153,6 +153,6 @@ async::Channel<unsigned int> SanitySynthesizer::audioChannelsCountChanged() cons
 
 audio::samples_t SanitySynthesizer::process(float* buffer, samples_t samplesPerChannel)
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
     return m_synth->process(buffer, samplesPerChannel);
 }
@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audioblockqueue.h"
+
+using namespace mu::audio;
+
+AudioBlockQueue::AudioBlockQueue(size_t blocksCount, size_t blockSize)
+    : m_blocks(blocksCount)
+{
+    for (Block& block : m_blocks) {
+        block.data.resize(blockSize, 0.f);
+    }
+}
+
+AudioBlockQueue::Block* AudioBlockQueue::beginWrite()
+{
+    size_t writtenCount = m_writtenCount.load(std::memory_order_relaxed);
+    if (writtenCount - m_readCount.load(std::memory_order_acquire) == m_blocks.size()) {
+        return nullptr;
+    }
+
+    return &m_blocks[writtenCount % m_blocks.size()];
+}
+
+void AudioBlockQueue::endWrite()
+{
+    m_writtenCount.fetch_add(1, std::memory_order_release);
+}
+
+AudioBlockQueue::Block* AudioBlockQueue::beginRead()
+{
+    size_t readCount = m_readCount.load(std::memory_order_relaxed);
+    if (readCount == m_writtenCount.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    return &m_blocks[readCount % m_blocks.size()];
+}
+
+void AudioBlockQueue::endRead()
+{
+    m_readCount.fetch_add(1, std::memory_order_release);
+}
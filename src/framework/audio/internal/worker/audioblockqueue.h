@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUDIOBLOCKQUEUE_H
+#define MU_AUDIO_AUDIOBLOCKQUEUE_H
+
+#include <atomic>
+#include <vector>
+
+#include "audiotypes.h"
+
+namespace mu::audio {
+//! NOTE A bounded lock-free queue of the sample blocks between two threads, one writes and one reads.
+//! The blocks are allocated once and reused, so the memory does not depend on the length of the render.
+//! A full queue makes the writer wait for the reader (and an empty one makes the reader wait for the writer)
+class AudioBlockQueue
+{
+public:
+    struct Block {
+        std::vector<float> data;
+        samples_t samplesPerChannel = 0;
+    };
+
+    AudioBlockQueue(size_t blocksCount, size_t blockSize);
+
+    Block* beginWrite(); //! NOTE nullptr when the queue is full
+    void endWrite();
+
+    Block* beginRead(); //! NOTE nullptr when the queue is empty
+    void endRead();
+
+private:
+    std::vector<Block> m_blocks;
+
+    //! NOTE The counters only grow, the writer owns the first one and the reader the second one
+    std::atomic<size_t> m_writtenCount = 0;
+    std::atomic<size_t> m_readCount = 0;
+};
+}
+
+#endif // MU_AUDIO_AUDIOBLOCKQUEUE_H
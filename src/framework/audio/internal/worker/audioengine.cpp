@@ -32,7 +32,7 @@ using namespace mu::audio;
 
 AudioEngine* AudioEngine::instance()
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
 
     static AudioEngine e;
     return &e;
@@ -81,6 +81,13 @@ void AudioEngine::deinit()
     }
 }
 
+unsigned int AudioEngine::sampleRate() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    return m_sampleRate;
+}
+
 void AudioEngine::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -89,6 +96,7 @@ void AudioEngine::setSampleRate(unsigned int sampleRate)
         return;
     }
 
+    m_sampleRate = sampleRate;
     m_mixer->mixedSource()->setSampleRate(sampleRate);
 }
 
@@ -114,6 +122,61 @@ void AudioEngine::setAudioChannelsCount(const audioch_t count)
     m_mixer->setAudioChannelsCount(count);
 }
 
+RenderMode AudioEngine::mode() const
+{
+    ONLY_AUDIO_PROCESSING_THREAD;
+
+    return m_mode;
+}
+
+void AudioEngine::setMode(const RenderMode newMode)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_mode == newMode) {
+        return;
+    }
+
+    IF_ASSERT_FAILED(m_mixer && m_buffer) {
+        return;
+    }
+
+    m_mode = newMode;
+
+    //! NOTE While rendering offline the mixer is driven by the renderer, the driver gets silence
+    switch (m_mode) {
+    case RenderMode::RealTimeMode:
+        m_mixer->setMode(m_mode);
+        m_buffer->setSource(m_mixer->mixedSource());
+        break;
+    case RenderMode::OfflineMode:
+        m_buffer->setSource(nullptr);
+        m_mixer->setMode(m_mode);
+        break;
+    }
+
+    if (m_mode == RenderMode::RealTimeMode) {
+        std::vector<std::function<void()> > deferredCalls;
+        deferredCalls.swap(m_deferredCalls);
+
+        for (const std::function<void()>& func : deferredCalls) {
+            func();
+        }
+    }
+}
+
+void AudioEngine::callInRealTimeMode(const std::function<void()>& func)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_mode == RenderMode::RealTimeMode) {
+        func();
+        return;
+    }
+
+    m_deferredCalls.push_back(func);
+}
+
 MixerPtr AudioEngine::mixer() const
 {
     ONLY_AUDIO_WORKER_THREAD;
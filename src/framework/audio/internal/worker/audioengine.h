@@ -22,7 +22,9 @@
 #ifndef MU_AUDIO_AUDIOENGINE_H
 #define MU_AUDIO_AUDIOENGINE_H
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -43,10 +45,19 @@ public:
     Ret init(IAudioBufferPtr bufferPtr);
     void deinit();
 
+    unsigned int sampleRate() const;
     void setSampleRate(unsigned int sampleRate);
     void setReadBufferSize(uint16_t readBufferSize);
     void setAudioChannelsCount(const audioch_t count);
 
+    RenderMode mode() const;
+    void setMode(const RenderMode newMode);
+
+    //! NOTE The offline renderer serves the queue of the worker between the blocks (for the notation events).
+    //! The requests which change the playback or the mix must not break the render halfway,
+    //! so they are called when it is over
+    void callInRealTimeMode(const std::function<void()>& func);
+
     MixerPtr mixer() const;
 
 private:
@@ -54,6 +65,10 @@ private:
 
     bool m_inited = false;
 
+    unsigned int m_sampleRate = 0;
+    RenderMode m_mode = RenderMode::RealTimeMode;
+    std::vector<std::function<void()> > m_deferredCalls;
+
     MixerPtr m_mixer = nullptr;
     IAudioBufferPtr m_buffer = nullptr;
 };
@@ -22,6 +22,8 @@
 
 #include "audiooutputhandler.h"
 
+#include <algorithm>
+
 #include "log.h"
 #include "async/async.h"
 
@@ -70,11 +72,13 @@ void AudioOutputHandler::setOutputParams(const TrackSequenceId sequenceId, const
     Async::call(this, [this, sequenceId, trackId, params]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, trackId, params]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (s) {
-            s->audioIO()->setOutputParams(trackId, params);
-        }
+            if (s) {
+                s->audioIO()->setOutputParams(trackId, params);
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -104,11 +108,13 @@ void AudioOutputHandler::setMasterOutputParams(const AudioOutputParams& params)
     Async::call(this, [this, params]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        IF_ASSERT_FAILED(mixer()) {
-            return;
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, params]() {
+            IF_ASSERT_FAILED(mixer()) {
+                return;
+            }
 
-        mixer()->setMasterOutputParams(params);
+            mixer()->setMasterOutputParams(params);
+        });
     }, AudioThread::ID);
 }
 
@@ -165,6 +171,106 @@ Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
     }, AudioThread::ID);
 }
 
+Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceId, const io::path& destination,
+                                                 const SoundTrackFormat& format)
+{
+    return saveSoundTrackStems(sequenceId, { SoundTrackStem { destination, {} } }, format);
+}
+
+Promise<bool> AudioOutputHandler::saveSoundTrackStems(const TrackSequenceId sequenceId, const SoundTrackStemList& stems,
+                                                      const SoundTrackFormat& format)
+{
+    return Promise<bool>([this, sequenceId, stems, format](Promise<bool>::Resolve resolve,
+                                                           Promise<bool>::Reject reject) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        ITrackSequencePtr s = sequence(sequenceId);
+
+        if (!s) {
+            reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+            return;
+        }
+
+        if (!format.isValid()) {
+            reject(static_cast<int>(Err::UnknownSoundTrackFormat), "invalid soundtrack format");
+            return;
+        }
+
+        if (stems.empty()) {
+            reject(static_cast<int>(Err::InvalidAudioFilePath), "no soundtrack stems");
+            return;
+        }
+
+        TrackIdList sequenceTrackIds = s->trackIdList();
+        for (const SoundTrackStem& stem : stems) {
+            for (const TrackId trackId : stem.trackIds) {
+                if (std::find(sequenceTrackIds.cbegin(), sequenceTrackIds.cend(), trackId) == sequenceTrackIds.cend()) {
+                    reject(static_cast<int>(Err::InvalidTrackId), "invalid track id");
+                    return;
+                }
+            }
+        }
+
+        //! NOTE The writer processes the queue of the worker, so the next request can arrive in the middle of a render
+        if (!m_soundTrackWriters.empty()) {
+            reject(static_cast<int>(Err::SoundTrackRenderBusy), "another soundtrack is being rendered");
+            return;
+        }
+
+        AudioEngine* engine = AudioEngine::instance();
+        unsigned int realTimeSampleRate = engine->sampleRate();
+
+        //! NOTE Offline the mixer is not tied to the driver, so it can run at the sample rate of the file
+        engine->setMode(RenderMode::OfflineMode);
+        mixer()->setSampleRate(format.sampleRate);
+
+        ISequencePlayerPtr player = s->player();
+        player->stop();
+        player->seek(0);
+        player->play();
+
+        SoundTrackWriterPtr writer = std::make_shared<SoundTrackWriter>(stems, format, mixer(), player);
+        writer->progress().onReceive(this, [this](const framework::Progress& progress) {
+            m_saveSoundTrackProgress.send(progress);
+        });
+
+        m_soundTrackWriters.push_back(writer);
+        Ret ret = writer->write();
+        m_soundTrackWriters.erase(std::find(m_soundTrackWriters.begin(), m_soundTrackWriters.end(), writer));
+
+        player->stop();
+
+        mixer()->setSampleRate(realTimeSampleRate);
+        engine->setMode(RenderMode::RealTimeMode);
+
+        if (!ret) {
+            reject(ret.code(), ret.text());
+            return;
+        }
+
+        resolve(true);
+    }, AudioThread::ID);
+}
+
+void AudioOutputHandler::abortSavingAllSoundTracks()
+{
+    //! NOTE The writer processes the queue of the worker between the blocks
+    Async::call(this, [this]() {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        for (SoundTrackWriterPtr& writer : m_soundTrackWriters) {
+            writer->abort();
+        }
+    }, AudioThread::ID);
+}
+
+framework::ProgressChannel AudioOutputHandler::saveSoundTrackProgress() const
+{
+    ONLY_AUDIO_MAIN_OR_WORKER_THREAD;
+
+    return m_saveSoundTrackProgress;
+}
+
 std::shared_ptr<Mixer> AudioOutputHandler::mixer() const
 {
     return AudioEngine::instance()->mixer();
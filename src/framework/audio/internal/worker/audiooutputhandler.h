@@ -29,6 +29,7 @@
 #include "ifxresolver.h"
 #include "iaudiooutput.h"
 #include "igettracksequence.h"
+#include "soundtrackwriter.h"
 
 namespace mu::audio {
 class Mixer;
@@ -52,6 +53,13 @@ public:
     async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const override;
     async::Promise<AudioSignalChanges> masterSignalChanges() const override;
 
+    async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path& destination,
+                                        const SoundTrackFormat& format) override;
+    async::Promise<bool> saveSoundTrackStems(const TrackSequenceId sequenceId, const SoundTrackStemList& stems,
+                                             const SoundTrackFormat& format) override;
+    void abortSavingAllSoundTracks() override;
+    framework::ProgressChannel saveSoundTrackProgress() const override;
+
 private:
     std::shared_ptr<Mixer> mixer() const;
     ITrackSequencePtr sequence(const TrackSequenceId id) const;
@@ -62,6 +70,9 @@ private:
 
     mutable async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     mutable async::Channel<TrackSequenceId, TrackId, AudioOutputParams> m_outputParamsChanged;
+
+    std::vector<SoundTrackWriterPtr> m_soundTrackWriters;
+    framework::ProgressChannel m_saveSoundTrackProgress;
 };
 }
 
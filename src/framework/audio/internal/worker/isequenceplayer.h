@@ -40,10 +40,16 @@ public:
     virtual void pause() = 0;
     virtual void resume() = 0;
 
+    virtual msecs_t duration() const = 0;
     virtual void setDuration(const msecs_t duration) = 0;
     virtual Ret setLoop(const msecs_t fromMsec, const msecs_t toMsec) = 0;
     virtual void resetLoop() = 0;
 
+    //! NOTE For the offline render: the tracks request the events they will need for the next msecs,
+    //! and some of them may still wait for the requested events
+    virtual void requestEventsForNextMsecs(const msecs_t nextMsecsNumber) = 0;
+    virtual bool isWaitingForEvents() const = 0;
+
     virtual async::Channel<msecs_t> playbackPositionMSecs() const = 0;
     virtual async::Channel<PlaybackStatus> playbackStatusChanged() const = 0;
 };
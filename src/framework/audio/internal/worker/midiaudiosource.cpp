@@ -29,6 +29,7 @@
 #include "realfn.h"
 #include "internal/audiosanitizer.h"
 #include "internal/synthesizers/fluidsynth/fluidsynth.h"
+#include "audioengine.h"
 
 using namespace mu;
 using namespace mu::audio;
@@ -43,6 +44,11 @@ MidiAudioSource::MidiAudioSource(const TrackId trackId, const MidiData& midiData
     ONLY_AUDIO_WORKER_THREAD;
 
     m_stream.backgroundStream.onReceive(this, [this](Events events, tick_t endTick) {
+        //! NOTE The offline render must not pick up the notes played meanwhile (e.g. by the note input)
+        if (AudioEngine::instance()->mode() == RenderMode::OfflineMode) {
+            return;
+        }
+
         invalidateCaches(m_backgroundStreamEventsBuffer);
 
         m_backgroundStreamEventsBuffer.endTick = std::move(endTick);
@@ -69,7 +75,7 @@ MidiAudioSource::~MidiAudioSource()
 
 bool MidiAudioSource::isActive() const
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
 
     if (!m_synth) {
         return false;
@@ -186,13 +192,18 @@ void MidiAudioSource::handleMainStream(const msecs_t nextMsecsNumber)
 
     tick_t nextTicksNumber = tickFromMsec(nextMsecsNumber);
 
-    requestNextEvents(nextTicksNumber);
+    //! NOTE Offline the block may be processed by a worker helper thread, which must not send requests,
+    //! the renderer requests the events on the worker before each block, see requestEventsForNextMsecs
+    if (AudioEngine::instance()->mode() == RenderMode::RealTimeMode) {
+        requestNextEvents(nextTicksNumber);
+    }
+
     findAndSendNextEvents(m_mainStreamEventsBuffer, nextTicksNumber);
 }
 
 void MidiAudioSource::handleNextMsecs(const msecs_t nextMsecsNumber)
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
 
     handleBackgroundStream(nextMsecsNumber);
 
@@ -216,7 +227,7 @@ void MidiAudioSource::setSampleRate(unsigned int sampleRate)
 
 unsigned int MidiAudioSource::audioChannelsCount() const
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
 
     if (!m_synth) {
         return 0;
@@ -238,7 +249,7 @@ async::Channel<unsigned int> MidiAudioSource::audioChannelsCountChanged() const
 
 samples_t MidiAudioSource::process(float* buffer, samples_t samplesPerChannel)
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
 
     if (!m_synth) {
         return 0;
@@ -262,9 +273,15 @@ bool MidiAudioSource::sendEvents(const std::vector<Event>& events)
         return false;
     }
 
+    //! NOTE Rendering offline runs ahead of the real time, so the events must not reach the external devices
+    bool isRealTime = AudioEngine::instance()->mode() == RenderMode::RealTimeMode;
+
     for (const Event& event : events) {
         m_synth->handleEvent(event);
-        midiOutPort()->sendEvent(event);
+
+        if (isRealTime) {
+            midiOutPort()->sendEvent(event);
+        }
     }
 
     return true;
@@ -280,6 +297,24 @@ void MidiAudioSource::seek(const msecs_t newPositionMsecs)
     requestNextEvents(MINIMAL_REQUIRED_LOOKAHEAD);
 }
 
+void MidiAudioSource::requestEventsForNextMsecs(const msecs_t nextMsecsNumber)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!isActive() || m_mainStreamEventsBuffer.currentTick == m_stream.lastTick) {
+        return;
+    }
+
+    requestNextEvents(tickFromMsec(nextMsecsNumber));
+}
+
+bool MidiAudioSource::isWaitingForEvents() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    return m_hasActiveRequest;
+}
+
 const AudioInputParams& MidiAudioSource::inputParams() const
 {
     return m_params;
@@ -56,6 +56,8 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
     void seek(const msecs_t newPositionMsecs) override;
+    void requestEventsForNextMsecs(const msecs_t nextMsecsNumber) override;
+    bool isWaitingForEvents() const override;
 
     const AudioInputParams& inputParams() const override;
     void applyInputParams(const AudioInputParams& requiredParams) override;
@@ -38,11 +38,18 @@ using namespace mu::async;
 Mixer::Mixer()
 {
     ONLY_AUDIO_WORKER_THREAD;
+
+    m_telemetryStage = AudioTelemetry::registerStage("mixer");
 }
 
 Mixer::~Mixer()
 {
     ONLY_AUDIO_WORKER_THREAD;
+
+    AudioTelemetry::unregisterStage(m_telemetryStage);
+    for (AudioTelemetry::StageId stage : m_masterFxTelemetryStages) {
+        AudioTelemetry::unregisterStage(stage);
+    }
 }
 
 IAudioSourcePtr Mixer::mixedSource()
@@ -92,6 +99,74 @@ void Mixer::setAudioChannelsCount(const audioch_t count)
     m_audioChannelsCount = count;
 }
 
+void Mixer::setMode(const RenderMode mode)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_mode == mode) {
+        return;
+    }
+
+    m_mode = mode;
+
+    //! NOTE In real time the channels are cheap enough for one thread and the helpers would only add latency
+    m_processingPool = nullptr;
+    m_parallelChannels.clear();
+    m_parallelBuffers.clear();
+
+    //! NOTE Offline the channels are always rendered into their own buffers (even without the helpers),
+    //! so the stems can be taken from them
+    if (m_mode == RenderMode::OfflineMode) {
+        unsigned int threadsCount = std::thread::hardware_concurrency();
+        m_processingPool = std::make_unique<ProcessingPool>(threadsCount > 1 ? threadsCount - 1 : 0);
+    }
+}
+
+const float* Mixer::channelOutput(const TrackId trackId) const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_mode == RenderMode::OfflineMode) {
+        return nullptr;
+    }
+
+    auto search = m_mixerChannels.find(trackId);
+    if (search == m_mixerChannels.end()) {
+        return nullptr;
+    }
+
+    size_t index = static_cast<size_t>(std::distance(m_mixerChannels.begin(), search));
+    if (index >= m_parallelChannels.size() || m_parallelChannels[index] != search->second.get()) {
+        return nullptr;
+    }
+
+    return m_parallelBuffers[index].data();
+}
+
+void Mixer::mixTracksOutput(const TrackIdList& trackIds, float* outBuffer, samples_t samplesPerChannel) const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(outBuffer) {
+        return;
+    }
+
+    size_t samplesCount = samplesPerChannel * audioChannelsCount();
+
+    std::fill(outBuffer, outBuffer + samplesCount, 0.f);
+
+    for (const TrackId trackId : trackIds) {
+        const float* channelData = channelOutput(trackId);
+        if (!channelData) {
+            continue;
+        }
+
+        for (size_t i = 0; i < samplesCount; ++i) {
+            outBuffer[i] += channelData[i];
+        }
+    }
+}
+
 void Mixer::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -116,12 +191,44 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    for (IClockPtr clock : m_clocks) {
-        clock->forward((samplesPerChannel * 1000) / m_sampleRate);
+    AudioBlockTimer blockTimer(m_telemetryStage, samplesPerChannel, m_sampleRate);
+
+    //! NOTE The offline renderer keeps the playback position by itself,
+    //! the clocks would only spam the position changes and apply the loops
+    if (m_mode == RenderMode::RealTimeMode) {
+        for (IClockPtr clock : m_clocks) {
+            clock->forward((samplesPerChannel * 1000) / m_sampleRate);
+        }
     }
 
     std::fill(outBuffer, outBuffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
+    samples_t masterChannelSampleCount = m_processingPool
+                                         ? processChannelsInParallel(outBuffer, samplesPerChannel)
+                                         : processChannels(outBuffer, samplesPerChannel);
+
+    if (m_masterParams.muted || masterChannelSampleCount == 0) {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            notifyAboutAudioSignalChanges(audioChNum, 0);
+        }
+        return 0;
+    }
+
+    completeOutput(outBuffer, samplesPerChannel);
+
+    for (size_t i = 0; i < m_masterFxProcessors.size(); ++i) {
+        IFxProcessorPtr& fxProcessor = m_masterFxProcessors[i];
+        if (fxProcessor->active()) {
+            AudioBlockTimer fxTimer(m_masterFxTelemetryStages[i], samplesPerChannel, m_sampleRate);
+            fxProcessor->process(outBuffer, samplesPerChannel);
+        }
+    }
+
+    return masterChannelSampleCount;
+}
+
+samples_t Mixer::processChannels(float* outBuffer, samples_t samplesPerChannel)
+{
     if (m_writeCacheBuff.size() != samplesPerChannel * audioChannelsCount()) {
         m_writeCacheBuff.resize(samplesPerChannel * audioChannelsCount(), 0.f);
     }
@@ -136,19 +243,41 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         masterChannelSampleCount = std::max(processedSamplesCount, masterChannelSampleCount);
     }
 
-    if (m_masterParams.muted || masterChannelSampleCount == 0) {
-        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0);
-        }
-        return 0;
+    return masterChannelSampleCount;
+}
+
+samples_t Mixer::processChannelsInParallel(float* outBuffer, samples_t samplesPerChannel)
+{
+    //! NOTE Each channel has its own synth and fx chain, so the channels are rendered independently,
+    //! and then are mixed in the same order as by processChannels, so the result is the same
+    m_parallelChannels.clear();
+    for (auto& channel : m_mixerChannels) {
+        m_parallelChannels.push_back(channel.second.get());
     }
 
-    completeOutput(outBuffer, samplesPerChannel);
+    size_t channelsCount = m_parallelChannels.size();
+    size_t bufferSize = samplesPerChannel * audioChannelsCount();
 
-    for (IFxProcessorPtr& fxProcessor : m_masterFxProcessors) {
-        if (fxProcessor->active()) {
-            fxProcessor->process(outBuffer, samplesPerChannel);
-        }
+    if (m_parallelBuffers.size() < channelsCount) {
+        m_parallelBuffers.resize(channelsCount);
+    }
+    m_parallelSampleCounts.assign(channelsCount, 0);
+
+    m_processingPool->run(channelsCount, [this, bufferSize, samplesPerChannel](size_t index) {
+        std::vector<float>& buffer = m_parallelBuffers[index];
+        buffer.assign(bufferSize, 0.f);
+
+        m_parallelSampleCounts[index] = m_parallelChannels[index]->render(buffer.data(), samplesPerChannel);
+    });
+
+    samples_t masterChannelSampleCount = 0;
+
+    for (size_t i = 0; i < channelsCount; ++i) {
+        //! NOTE The helpers do not send anything, the signal changes are sent from here
+        m_parallelChannels[i]->notifyAboutAudioSignalChanges();
+
+        mixOutputFromChannel(outBuffer, m_parallelBuffers[i].data(), m_parallelSampleCounts[i]);
+        masterChannelSampleCount = std::max(m_parallelSampleCounts[i], masterChannelSampleCount);
     }
 
     return masterChannelSampleCount;
@@ -189,8 +318,14 @@ void Mixer::setMasterOutputParams(const AudioOutputParams& params)
     m_masterFxProcessors = fxResolver()->resolveMasterFxList(params.fxChain);
     m_masterOutputParamsChanged.send(params);
 
+    for (AudioTelemetry::StageId stage : m_masterFxTelemetryStages) {
+        AudioTelemetry::unregisterStage(stage);
+    }
+    m_masterFxTelemetryStages.clear();
+
     for (IFxProcessorPtr& fx : m_masterFxProcessors) {
         fx->setSampleRate(m_sampleRate);
+        m_masterFxTelemetryStages.push_back(AudioTelemetry::registerStage("master fx: " + fx->params().resourceMeta.id));
     }
 }
 
@@ -30,7 +30,9 @@
 
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
+#include "processingpool.h"
 #include "internal/dsp/limiter.h"
+#include "internal/audiotelemetry.h"
 #include "ifxresolver.h"
 #include "iclock.h"
 
@@ -49,6 +51,15 @@ public:
 
     void setAudioChannelsCount(const audioch_t count);
 
+    void setMode(const RenderMode mode);
+
+    //! NOTE The output of the channel in the last processed block, only in the offline mode
+    const float* channelOutput(const TrackId trackId) const;
+
+    //! NOTE Sums the outputs of the channels in the last processed block (after their own fx and volume,
+    //! but before the master ones), only in the offline mode
+    void mixTracksOutput(const TrackIdList& trackIds, float* outBuffer, samples_t samplesPerChannel) const;
+
     void addClock(IClockPtr clock);
     void removeClock(IClockPtr clock);
 
@@ -64,12 +75,21 @@ public:
     samples_t process(float* outBuffer, samples_t samplesPerChannel) override;
 
 private:
+    samples_t processChannels(float* outBuffer, samples_t samplesPerChannel);
+    samples_t processChannelsInParallel(float* outBuffer, samples_t samplesPerChannel);
+
     void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
 
     std::vector<float> m_writeCacheBuff;
 
+    RenderMode m_mode = RenderMode::RealTimeMode;
+    std::unique_ptr<ProcessingPool> m_processingPool;
+    std::vector<MixerChannel*> m_parallelChannels;
+    std::vector<std::vector<float> > m_parallelBuffers;
+    std::vector<samples_t> m_parallelSampleCounts;
+
     AudioOutputParams m_masterParams;
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
@@ -81,6 +101,9 @@ private:
     audioch_t m_audioChannelsCount = 0;
 
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    AudioTelemetry::StageId m_telemetryStage = AudioTelemetry::INVALID_STAGE;
+    std::vector<AudioTelemetry::StageId> m_masterFxTelemetryStages;
 };
 
 using MixerPtr = std::shared_ptr<Mixer>;
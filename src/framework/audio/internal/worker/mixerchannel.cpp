@@ -41,6 +41,25 @@ MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const
     ONLY_AUDIO_WORKER_THREAD;
 
     setSampleRate(sampleRate);
+
+    std::string trackName = "track " + std::to_string(trackId);
+    m_telemetryStage = AudioTelemetry::registerStage(trackName);
+    m_sourceTelemetryStage = AudioTelemetry::registerStage(trackName + ": synth");
+}
+
+MixerChannel::~MixerChannel()
+{
+    AudioTelemetry::unregisterStage(m_telemetryStage);
+    AudioTelemetry::unregisterStage(m_sourceTelemetryStage);
+    unregisterFxTelemetryStages();
+}
+
+void MixerChannel::unregisterFxTelemetryStages()
+{
+    for (AudioTelemetry::StageId stage : m_fxTelemetryStages) {
+        AudioTelemetry::unregisterStage(stage);
+    }
+    m_fxTelemetryStages.clear();
 }
 
 const AudioOutputParams& MixerChannel::outputParams() const
@@ -59,8 +78,12 @@ void MixerChannel::applyOutputParams(const AudioOutputParams& requiredParams)
     m_fxProcessors.clear();
     m_fxProcessors = fxResolver()->resolveFxList(m_trackId, requiredParams.fxChain);
 
+    unregisterFxTelemetryStages();
+
     for (IFxProcessorPtr& fx : m_fxProcessors) {
         fx->setSampleRate(m_sampleRate);
+        m_fxTelemetryStages.push_back(AudioTelemetry::registerStage("track " + std::to_string(m_trackId)
+                                                                    + ": fx " + fx->params().resourceMeta.id));
 
         fx->paramsChanged().onReceive(this, [this](const AudioFxParams& fxParams) {
             m_params.fxChain.insert_or_assign(fxParams.chainOrder, fxParams);
@@ -133,7 +156,7 @@ void MixerChannel::setSampleRate(unsigned int sampleRate)
 
 unsigned int MixerChannel::audioChannelsCount() const
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    ONLY_AUDIO_PROCESSING_THREAD;
 
     IF_ASSERT_FAILED(m_audioSource) {
         return 0;
@@ -157,26 +180,42 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    samples_t processedSamplesCount = render(buffer, samplesPerChannel);
+    notifyAboutAudioSignalChanges();
+
+    return processedSamplesCount;
+}
+
+samples_t MixerChannel::render(float* buffer, samples_t samplesPerChannel)
+{
+    ONLY_AUDIO_PROCESSING_THREAD;
+
     IF_ASSERT_FAILED(m_audioSource) {
         return 0;
     }
 
-    samples_t processedSamplesCount = m_audioSource->process(buffer, samplesPerChannel);
+    AudioBlockTimer blockTimer(m_telemetryStage, samplesPerChannel, m_sampleRate);
+
+    samples_t processedSamplesCount = 0;
+    {
+        AudioBlockTimer sourceTimer(m_sourceTelemetryStage, samplesPerChannel, m_sampleRate);
+        processedSamplesCount = m_audioSource->process(buffer, samplesPerChannel);
+    }
 
     if (processedSamplesCount == 0 || m_params.muted) {
         std::fill(buffer, buffer + samplesPerChannel * audioChannelsCount(), 0.f);
-
-        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0.f);
-        }
+        m_signalRms.assign(audioChannelsCount(), 0.f);
 
         return processedSamplesCount;
     }
 
-    for (IFxProcessorPtr fx : m_fxProcessors) {
+    for (size_t i = 0; i < m_fxProcessors.size(); ++i) {
+        IFxProcessorPtr& fx = m_fxProcessors[i];
         if (!fx->active()) {
             continue;
         }
+
+        AudioBlockTimer fxTimer(m_fxTelemetryStages[i], samplesPerChannel, m_sampleRate);
         fx->process(buffer, samplesPerChannel);
     }
 
@@ -185,10 +224,12 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
     return processedSamplesCount;
 }
 
-void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
+void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount)
 {
     float totalSquaredSum = 0.f;
 
+    m_signalRms.assign(audioChannelsCount(), 0.f);
+
     for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
         float singleChannelSquaredSum = 0.f;
 
@@ -205,16 +246,19 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) cons
             totalSquaredSum += squaredSample;
         }
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
-
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+        m_signalRms[audioChNum] = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
     }
 
     float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesCount * audioChannelsCount());
     m_compressor->process(totalRms, buffer, audioChannelsCount(), samplesCount);
 }
 
-void MixerChannel::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
+void MixerChannel::notifyAboutAudioSignalChanges()
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    ONLY_AUDIO_WORKER_THREAD;
+
+    for (audioch_t audioChNum = 0; audioChNum < m_signalRms.size(); ++audioChNum) {
+        float linearRms = m_signalRms[audioChNum];
+        m_audioSignalNotifier.updateSignalValues(audioChNum, linearRms, dsp::dbFromSample(linearRms));
+    }
 }
@@ -30,6 +30,7 @@
 #include "ifxprocessor.h"
 #include "track.h"
 #include "internal/dsp/compressor.h"
+#include "internal/audiotelemetry.h"
 
 namespace mu::audio {
 class MixerChannel : public ITrackAudioOutput, public async::Asyncable
@@ -38,6 +39,7 @@ class MixerChannel : public ITrackAudioOutput, public async::Asyncable
 
 public:
     explicit MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate);
+    ~MixerChannel() override;
 
     const AudioOutputParams& outputParams() const override;
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
@@ -53,9 +55,14 @@ public:
     async::Channel<unsigned int> audioChannelsCountChanged() const override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
+    //! NOTE Processes the block without sending anything, so it can run on a worker helper thread.
+    //! The signal values are sent by notifyAboutAudioSignalChanges, on the worker
+    samples_t render(float* buffer, samples_t samplesPerChannel);
+    void notifyAboutAudioSignalChanges();
+
 private:
-    void completeOutput(float* buffer, unsigned int samplesCount) const;
-    void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void completeOutput(float* buffer, unsigned int samplesCount);
+    void unregisterFxTelemetryStages();
 
     TrackId m_trackId = -1;
 
@@ -69,6 +76,11 @@ private:
 
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+    std::vector<float> m_signalRms;
+
+    AudioTelemetry::StageId m_telemetryStage = AudioTelemetry::INVALID_STAGE;
+    AudioTelemetry::StageId m_sourceTelemetryStage = AudioTelemetry::INVALID_STAGE;
+    std::vector<AudioTelemetry::StageId> m_fxTelemetryStages;
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
@@ -27,6 +27,7 @@
 
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
+#include "internal/worker/audioengine.h"
 #include "audioerrors.h"
 
 using namespace mu::audio;
@@ -47,10 +48,12 @@ void PlayerHandler::play(const TrackSequenceId sequenceId)
     Async::call(this, [this, sequenceId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->play();
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->play();
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -59,10 +62,12 @@ void PlayerHandler::seek(const TrackSequenceId sequenceId, const msecs_t newPosi
     Async::call(this, [this, sequenceId, newPositionMsecs]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->seek(newPositionMsecs);
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, newPositionMsecs]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->seek(newPositionMsecs);
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -71,10 +76,12 @@ void PlayerHandler::stop(const TrackSequenceId sequenceId)
     Async::call(this, [this, sequenceId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->stop();
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->stop();
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -83,10 +90,12 @@ void PlayerHandler::pause(const TrackSequenceId sequenceId)
     Async::call(this, [this, sequenceId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->pause();
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->pause();
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -95,10 +104,12 @@ void PlayerHandler::resume(const TrackSequenceId sequenceId)
     Async::call(this, [this, sequenceId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->resume();
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->resume();
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -107,10 +118,12 @@ void PlayerHandler::setDuration(const TrackSequenceId sequenceId, const msecs_t
     Async::call(this, [this, sequenceId, durationMsec]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->setDuration(durationMsec);
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, durationMsec]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->setDuration(durationMsec);
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -119,19 +132,21 @@ Promise<bool> PlayerHandler::setLoop(const TrackSequenceId sequenceId, const mse
     return Promise<bool>([this, sequenceId, fromMsec, toMsec](Promise<bool>::Resolve resolve, Promise<bool>::Reject reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, fromMsec, toMsec, resolve, reject]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (!s) {
-            reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
-        }
+            if (!s) {
+                reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+            }
 
-        Ret result = s->player()->setLoop(fromMsec, toMsec);
+            Ret result = s->player()->setLoop(fromMsec, toMsec);
 
-        if (!result) {
-            reject(result.code(), result.text());
-        }
+            if (!result) {
+                reject(result.code(), result.text());
+            }
 
-        resolve(result);
+            resolve(result);
+        });
     }, AudioThread::ID);
 }
 
@@ -140,10 +155,12 @@ void PlayerHandler::resetLoop(const TrackSequenceId sequenceId)
     Async::call(this, [this, sequenceId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->resetLoop();
-        }
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
+            if (s) {
+                s->player()->resetLoop();
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "processingpool.h"
+
+#include "runtime.h"
+
+#include "internal/audiosanitizer.h"
+
+using namespace mu::audio;
+
+ProcessingPool::ProcessingPool(size_t helperThreadsCount)
+{
+    for (size_t i = 0; i < helperThreadsCount; ++i) {
+        m_threads.emplace_back([this]() {
+            helperThreadLoop();
+        });
+    }
+}
+
+ProcessingPool::~ProcessingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_started.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t ProcessingPool::threadsCount() const
+{
+    return m_threads.size() + 1;
+}
+
+void ProcessingPool::run(size_t tasksCount, const Task& task)
+{
+    if (tasksCount == 0) {
+        return;
+    }
+
+    //! NOTE Not worth waking up the helpers
+    if (tasksCount == 1 || m_threads.empty()) {
+        for (size_t i = 0; i < tasksCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_tasksCount = tasksCount;
+        m_nextTask = 0;
+        m_busyThreadsCount = m_threads.size();
+        ++m_generation;
+    }
+
+    m_started.notify_all();
+
+    processTasks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this]() {
+        return m_busyThreadsCount == 0;
+    });
+
+    m_task = nullptr;
+}
+
+void ProcessingPool::helperThreadLoop()
+{
+    mu::runtime::setThreadName("audio_worker_helper");
+    AudioSanitizer::setupWorkerHelperThread();
+
+    uint64_t generation = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_started.wait(lock, [this, generation]() {
+                return m_isStopping || m_generation != generation;
+            });
+
+            if (m_isStopping) {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        processTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_busyThreadsCount;
+        }
+
+        m_finished.notify_one();
+    }
+}
+
+void ProcessingPool::processTasks()
+{
+    for (size_t i = m_nextTask++; i < m_tasksCount; i = m_nextTask++) {
+        (*m_task)(i);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_PROCESSINGPOOL_H
+#define MU_AUDIO_PROCESSINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mu::audio {
+//! NOTE Runs independent parts of a block (e.g. the mixer channels) in parallel.
+//! The calling thread takes part in the work and returns when all the parts are done.
+//! The helper threads act on behalf of the worker thread, so the parts may touch only their own data.
+class ProcessingPool
+{
+public:
+    explicit ProcessingPool(size_t helperThreadsCount);
+    ~ProcessingPool();
+
+    size_t threadsCount() const;
+
+    using Task = std::function<void (size_t index)>;
+    void run(size_t tasksCount, const Task& task);
+
+private:
+    void helperThreadLoop();
+    void processTasks();
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_started;
+    std::condition_variable m_finished;
+
+    const Task* m_task = nullptr;
+    size_t m_tasksCount = 0;
+    std::atomic<size_t> m_nextTask = 0;
+
+    uint64_t m_generation = 0;
+    size_t m_busyThreadsCount = 0;
+    bool m_isStopping = false;
+};
+}
+
+#endif // MU_AUDIO_PROCESSINGPOOL_H
@@ -95,6 +95,13 @@ void SequencePlayer::resume()
     }
 }
 
+msecs_t SequencePlayer::duration() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    return m_clock->timeDuration();
+}
+
 void SequencePlayer::setDuration(const msecs_t duration)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -116,6 +123,30 @@ void SequencePlayer::resetLoop()
     m_clock->resetTimeLoop();
 }
 
+void SequencePlayer::requestEventsForNextMsecs(const msecs_t nextMsecsNumber)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    for (auto& pair : tracks()) {
+        if (pair.second->inputHandler) {
+            pair.second->inputHandler->requestEventsForNextMsecs(nextMsecsNumber);
+        }
+    }
+}
+
+bool SequencePlayer::isWaitingForEvents() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    for (const auto& pair : tracks()) {
+        if (pair.second->inputHandler && pair.second->inputHandler->isWaitingForEvents()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 Channel<msecs_t> SequencePlayer::playbackPositionMSecs() const
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -41,10 +41,14 @@ public:
     void pause() override;
     void resume() override;
 
+    msecs_t duration() const override;
     void setDuration(const msecs_t duration) override;
     Ret setLoop(const msecs_t fromMsec, const msecs_t toMsec) override;
     void resetLoop() override;
 
+    void requestEventsForNextMsecs(const msecs_t nextMsecsNumber) override;
+    bool isWaitingForEvents() const override;
+
     async::Channel<msecs_t> playbackPositionMSecs() const override;
     async::Channel<PlaybackStatus> playbackStatusChanged() const override;
 
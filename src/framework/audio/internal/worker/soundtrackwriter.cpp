@@ -0,0 +1,404 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "soundtrackwriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <QtGlobal>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#define ENABLE_SNDFILE_WINDOWS_PROTOTYPES 1
+#endif
+#include <sndfile.h>
+
+#include "log.h"
+#include "runtime.h"
+#include "async/processevents.h"
+
+#include "internal/audiosanitizer.h"
+#include "audioerrors.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+//! NOTE The same block size as the real time buffer uses, so the events are timed the same way
+static constexpr samples_t RENDER_BLOCK_SIZE = 1024;
+
+//! NOTE About 0.75 s at 44.1 kHz: enough to smooth out the uneven blocks of both sides,
+//! and only 256 KB per stereo stem
+static constexpr size_t RENDER_QUEUE_BLOCKS_COUNT = 32;
+
+//! NOTE The events come from the main thread, it may be busy for a while, but not forever
+static constexpr std::chrono::seconds EVENTS_WAIT_TIMEOUT(10);
+
+//! NOTE MP3 is encoded by libsndfile since 1.1.0 (through lame), the build checks whether its headers have MPEG,
+//! sf_format_check still tells at run time whether the library was built with the encoder
+#ifdef MU_AUDIO_SNDFILE_SUPPORTS_MPEG
+static constexpr int MP3_MIN_BITRATE = 32;
+static constexpr int MP3_MAX_BITRATE = 320;
+#endif
+
+static int sndFileFormat(const SoundTrackType type)
+{
+    switch (type) {
+    case SoundTrackType::WAV: return SF_FORMAT_WAV | SF_FORMAT_PCM_16;
+    case SoundTrackType::FLAC: return SF_FORMAT_FLAC | SF_FORMAT_PCM_16;
+    case SoundTrackType::OGG: return SF_FORMAT_OGG | SF_FORMAT_VORBIS;
+#ifdef MU_AUDIO_SNDFILE_SUPPORTS_MPEG
+    case SoundTrackType::MP3: return SF_FORMAT_MPEG | SF_FORMAT_MPEG_LAYER_III;
+#else
+    case SoundTrackType::MP3: break;
+#endif
+    case SoundTrackType::Undefined: break;
+    }
+
+    return 0;
+}
+
+SoundTrackWriter::SoundTrackWriter(const SoundTrackStemList& stems, const SoundTrackFormat& format, MixerPtr mixer,
+                                   ISequencePlayerPtr player)
+    : m_format(format), m_mixer(std::move(mixer)), m_player(std::move(player))
+{
+    for (const SoundTrackStem& stem : stems) {
+        StemFile stemFile;
+        stemFile.stem = stem;
+        m_stemFiles.push_back(std::move(stemFile));
+    }
+
+    //! NOTE The encoders are independent, and the lossy ones are the slowest part of the render,
+    //! so the stems are encoded in parallel, the encoder thread takes one of them
+    size_t threadsCount = std::min(m_stemFiles.size(), static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+    m_encodingPool = std::make_unique<ProcessingPool>(threadsCount > 0 ? threadsCount - 1 : 0);
+}
+
+SoundTrackWriter::~SoundTrackWriter()
+{
+    if (m_encoderThread.joinable()) {
+        m_aborted = true;
+        m_encoderThread.join();
+    }
+
+    close();
+}
+
+Ret SoundTrackWriter::write()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_mixer && m_player && !m_stemFiles.empty()) {
+        return make_ret(Err::InvalidAudioSource);
+    }
+
+    Ret ret = open();
+    if (!ret) {
+        return ret;
+    }
+
+    audioch_t audioChannelsCount = m_mixer->audioChannelsCount();
+    samples_t totalSamples = m_player->duration() * m_format.sampleRate / 1000;
+    samples_t renderedSamples = 0;
+
+    m_buffer.resize(RENDER_BLOCK_SIZE * audioChannelsCount);
+    m_queue = std::make_unique<AudioBlockQueue>(RENDER_QUEUE_BLOCKS_COUNT, m_buffer.size() * m_stemFiles.size());
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    m_renderFinished = false;
+    m_encodingFailed = false;
+    m_encoderThread = std::thread([this]() {
+        encoderThreadLoop();
+    });
+
+    msecs_t blockMsecs = RENDER_BLOCK_SIZE * 1000 / m_format.sampleRate;
+
+    while (renderedSamples < totalSamples) {
+        //! NOTE The channels may be rendered by the helper threads, which do not send anything,
+        //! so the events for the next block are requested from here
+        m_player->requestEventsForNextMsecs(blockMsecs);
+
+        ret = waitForEvents();
+        if (!ret) {
+            break;
+        }
+
+        if (m_aborted) {
+            ret = make_ret(Err::SoundTrackRenderAborted);
+            break;
+        }
+
+        AudioBlockQueue::Block* block = waitForFreeBlock();
+        if (!block) {
+            ret = make_ret(m_encodingFailed ? Err::SoundTrackWriteFailed : Err::SoundTrackRenderAborted);
+            break;
+        }
+
+        samples_t samplesPerChannel = std::min(RENDER_BLOCK_SIZE, totalSamples - renderedSamples);
+        m_mixer->process(m_buffer.data(), samplesPerChannel);
+
+        fillBlock(*block, samplesPerChannel);
+        m_queue->endWrite();
+
+        renderedSamples += samplesPerChannel;
+        sendProgress(renderedSamples, totalSamples);
+    }
+
+    //! NOTE The files of a failed render are useless, the encoders do not have to finish the queue
+    if (!ret) {
+        m_aborted = true;
+    }
+
+    m_renderFinished = true;
+    m_encoderThread.join();
+
+    if (ret && m_encodingFailed) {
+        ret = make_ret(Err::SoundTrackWriteFailed);
+    }
+
+    close();
+
+    if (!ret) {
+        return ret;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    double renderedSecs = static_cast<double>(totalSamples) / m_format.sampleRate;
+
+    LOGI() << "rendered " << renderedSecs << " s of audio in " << elapsed.count() << " s ("
+           << (elapsed.count() > 0 ? renderedSecs / elapsed.count() : 0.) << "x real time) to " << m_stemFiles.size() << " file(s), "
+           << m_stemFiles.front().stem.destination << (m_stemFiles.size() > 1 ? " and others" : "");
+
+    return make_ret(Err::NoError);
+}
+
+void SoundTrackWriter::abort()
+{
+    m_aborted = true;
+}
+
+framework::ProgressChannel SoundTrackWriter::progress() const
+{
+    return m_progress;
+}
+
+Ret SoundTrackWriter::open()
+{
+    for (StemFile& stemFile : m_stemFiles) {
+        Ret ret = openStemFile(stemFile);
+        if (!ret) {
+            close();
+            return ret;
+        }
+    }
+
+    return make_ret(Err::NoError);
+}
+
+Ret SoundTrackWriter::openStemFile(StemFile& stemFile)
+{
+    SF_INFO info = {};
+    info.samplerate = static_cast<int>(m_format.sampleRate);
+    info.channels = static_cast<int>(m_mixer->audioChannelsCount());
+    info.format = sndFileFormat(m_format.type);
+
+    if (info.format == 0 || info.channels == 0 || !sf_format_check(&info)) {
+        LOGE() << "unsupported format: " << static_cast<int>(m_format.type)
+               << ", sample rate: " << info.samplerate << ", channels: " << info.channels;
+        return make_ret(Err::UnknownSoundTrackFormat);
+    }
+
+#ifdef Q_OS_WIN
+    stemFile.file = sf_wchar_open(stemFile.stem.destination.toStdWString().c_str(), SFM_WRITE, &info);
+#else
+    stemFile.file = sf_open(stemFile.stem.destination.c_str(), SFM_WRITE, &info);
+#endif
+
+    if (!stemFile.file) {
+        LOGE() << "failed open " << stemFile.stem.destination << ": " << sf_strerror(nullptr);
+        return make_ret(Err::SoundTrackOpenFailed);
+    }
+
+    //! NOTE The limiter keeps the mix in range, but the clipping is still better than the wrap around
+    sf_command(stemFile.file, SFC_SET_CLIPPING, nullptr, SF_TRUE);
+
+    switch (m_format.type) {
+    case SoundTrackType::OGG: {
+        double quality = std::clamp(m_format.quality, 0., 1.);
+        sf_command(stemFile.file, SFC_SET_VBR_ENCODING_QUALITY, &quality, sizeof(quality));
+    } break;
+    case SoundTrackType::MP3: {
+#ifdef MU_AUDIO_SNDFILE_SUPPORTS_MPEG
+        int bitRate = std::clamp(m_format.bitRate, MP3_MIN_BITRATE, MP3_MAX_BITRATE);
+
+        int bitRateMode = SF_BITRATE_MODE_CONSTANT;
+        sf_command(stemFile.file, SFC_SET_BITRATE_MODE, &bitRateMode, sizeof(bitRateMode));
+
+        double compressionLevel = static_cast<double>(MP3_MAX_BITRATE - bitRate) / (MP3_MAX_BITRATE - MP3_MIN_BITRATE);
+        sf_command(stemFile.file, SFC_SET_COMPRESSION_LEVEL, &compressionLevel, sizeof(compressionLevel));
+#endif
+    } break;
+    case SoundTrackType::WAV:
+    case SoundTrackType::FLAC:
+    case SoundTrackType::Undefined:
+        break;
+    }
+
+    return make_ret(Err::NoError);
+}
+
+void SoundTrackWriter::close()
+{
+    for (StemFile& stemFile : m_stemFiles) {
+        if (!stemFile.file) {
+            continue;
+        }
+
+        sf_close(stemFile.file);
+        stemFile.file = nullptr;
+    }
+}
+
+void SoundTrackWriter::fillBlock(AudioBlockQueue::Block& block, samples_t samplesPerChannel) const
+{
+    size_t samplesCount = samplesPerChannel * m_mixer->audioChannelsCount();
+    size_t stemBlockSize = m_buffer.size();
+
+    block.samplesPerChannel = samplesPerChannel;
+
+    //! NOTE The stem without tracks is the master output
+    for (size_t index = 0; index < m_stemFiles.size(); ++index) {
+        const SoundTrackStem& stem = m_stemFiles[index].stem;
+        float* stemData = block.data.data() + index * stemBlockSize;
+
+        if (stem.trackIds.empty()) {
+            std::copy(m_buffer.cbegin(), m_buffer.cbegin() + samplesCount, stemData);
+            continue;
+        }
+
+        m_mixer->mixTracksOutput(stem.trackIds, stemData, samplesPerChannel);
+    }
+}
+
+void SoundTrackWriter::encoderThreadLoop()
+{
+    runtime::setThreadName("audio_encoder");
+
+    while (!m_aborted) {
+        //! NOTE Read the flag first: if the render was finished before, the queue already has all its blocks
+        bool isRenderFinished = m_renderFinished;
+
+        AudioBlockQueue::Block* block = m_queue->beginRead();
+        if (!block) {
+            if (isRenderFinished) {
+                return;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        if (!encodeBlock(*block)) {
+            m_encodingFailed = true;
+            return;
+        }
+
+        m_queue->endRead();
+    }
+}
+
+bool SoundTrackWriter::encodeBlock(const AudioBlockQueue::Block& block)
+{
+    size_t stemBlockSize = m_buffer.size();
+
+    m_encodingPool->run(m_stemFiles.size(), [this, &block, stemBlockSize](size_t index) {
+        StemFile& stemFile = m_stemFiles[index];
+        const float* data = block.data.data() + index * stemBlockSize;
+
+        sf_count_t framesCount = static_cast<sf_count_t>(block.samplesPerChannel);
+        stemFile.isWriteFailed = sf_writef_float(stemFile.file, data, framesCount) != framesCount;
+    });
+
+    for (const StemFile& stemFile : m_stemFiles) {
+        if (stemFile.isWriteFailed) {
+            LOGE() << "failed write to " << stemFile.stem.destination << ": " << sf_strerror(stemFile.file);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Ret SoundTrackWriter::waitForEvents()
+{
+    //! NOTE The answers to the events requests and the abort arrive through the queue of this thread.
+    //! The other requests (play, seek, params, tracks...) are deferred by the engine until the render is over,
+    //! see AudioEngine::callInRealTimeMode, so they do not change the sequence in the middle of it
+    async::processEvents();
+
+    auto waitStart = std::chrono::steady_clock::now();
+
+    while (m_player->isWaitingForEvents()) {
+        if (m_aborted) {
+            return make_ret(Err::SoundTrackRenderAborted);
+        }
+
+        if (std::chrono::steady_clock::now() - waitStart > EVENTS_WAIT_TIMEOUT) {
+            LOGE() << "no events for the sequence, giving up";
+            return make_ret(Err::SoundTrackRenderTimeout);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        async::processEvents();
+    }
+
+    return make_ret(Err::NoError);
+}
+
+AudioBlockQueue::Block* SoundTrackWriter::waitForFreeBlock()
+{
+    //! NOTE If the encoders are behind, the render waits for them, so the queue stays bounded.
+    //! Meanwhile it serves the queue of the worker like waitForEvents does: only the events and the abort
+    //! get through, the other requests are deferred until the render is over
+    AudioBlockQueue::Block* block = m_queue->beginWrite();
+
+    while (!block && !m_aborted && !m_encodingFailed) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        async::processEvents();
+        block = m_queue->beginWrite();
+    }
+
+    return block;
+}
+
+void SoundTrackWriter::sendProgress(samples_t renderedSamples, samples_t totalSamples)
+{
+    //! NOTE The main thread does not need thousands of updates
+    int64_t percent = static_cast<int64_t>(renderedSamples * 100 / totalSamples);
+    if (percent == m_lastProgressPercent) {
+        return;
+    }
+
+    m_lastProgressPercent = percent;
+    m_progress.send(framework::Progress(static_cast<int64_t>(renderedSamples), static_cast<int64_t>(totalSamples)));
+}
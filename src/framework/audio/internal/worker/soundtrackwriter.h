@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_SOUNDTRACKWRITER_H
+#define MU_AUDIO_SOUNDTRACKWRITER_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "async/asyncable.h"
+#include "global/progress.h"
+#include "retval.h"
+
+#include "isequenceplayer.h"
+#include "mixer.h"
+#include "processingpool.h"
+#include "audioblockqueue.h"
+#include "audiotypes.h"
+
+struct SNDFILE_tag;
+
+namespace mu::audio {
+//! NOTE Renders a sequence offline: the mixer is pulled block by block as fast as possible
+//! and the blocks are passed to the encoders through a bounded queue, so the whole track is never held in memory.
+//! The render runs on the worker and the encoding on its own thread, so both go at once.
+//! The sequence is rendered once for all the stems, each stem has its own encoder
+class SoundTrackWriter : public async::Asyncable
+{
+public:
+    SoundTrackWriter(const SoundTrackStemList& stems, const SoundTrackFormat& format, MixerPtr mixer, ISequencePlayerPtr player);
+    ~SoundTrackWriter();
+
+    Ret write();
+    void abort();
+
+    framework::ProgressChannel progress() const;
+
+private:
+    struct StemFile {
+        SoundTrackStem stem;
+        SNDFILE_tag* file = nullptr;
+        bool isWriteFailed = false;
+    };
+
+    Ret open();
+    Ret openStemFile(StemFile& stemFile);
+    void close();
+    void fillBlock(AudioBlockQueue::Block& block, samples_t samplesPerChannel) const;
+
+    void encoderThreadLoop();
+    bool encodeBlock(const AudioBlockQueue::Block& block);
+
+    Ret waitForEvents();
+    AudioBlockQueue::Block* waitForFreeBlock();
+    void sendProgress(samples_t renderedSamples, samples_t totalSamples);
+
+    SoundTrackFormat m_format;
+    MixerPtr m_mixer = nullptr;
+    ISequencePlayerPtr m_player = nullptr;
+
+    std::vector<StemFile> m_stemFiles;
+    std::vector<float> m_buffer;
+    std::unique_ptr<AudioBlockQueue> m_queue;
+    std::unique_ptr<ProcessingPool> m_encodingPool;
+    std::thread m_encoderThread;
+
+    std::atomic<bool> m_aborted = false;
+    std::atomic<bool> m_renderFinished = false;
+    std::atomic<bool> m_encodingFailed = false;
+    int64_t m_lastProgressPercent = -1;
+    framework::ProgressChannel m_progress;
+};
+
+using SoundTrackWriterPtr = std::shared_ptr<SoundTrackWriter>;
+}
+
+#endif // MU_AUDIO_SOUNDTRACKWRITER_H
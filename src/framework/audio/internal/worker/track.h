@@ -46,6 +46,10 @@ public:
     virtual ~ITrackAudioInput() = default;
 
     virtual void seek(const msecs_t newPositionMsecs) = 0;
+
+    //! NOTE In real time the events are requested while processing, offline it is done before each block
+    virtual void requestEventsForNextMsecs(const msecs_t nextMsecsNumber) = 0;
+    virtual bool isWaitingForEvents() const = 0;
     virtual const AudioInputParams& inputParams() const = 0;
     virtual void applyInputParams(const AudioInputParams& requiredParams) = 0;
     virtual async::Channel<AudioInputParams> inputParamsChanged() const = 0;
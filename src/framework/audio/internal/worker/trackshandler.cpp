@@ -28,6 +28,7 @@
 
 #include "internal/audiothread.h"
 #include "internal/audiosanitizer.h"
+#include "internal/worker/audioengine.h"
 #include "audioerrors.h"
 
 using namespace mu::audio;
@@ -81,20 +82,22 @@ Promise<TrackId, AudioParams> TracksHandler::addTrack(const TrackSequenceId sequ
                                                                                              Promise<TrackId, AudioParams>::Reject reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, trackName, playbackData, params, resolve, reject]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (!s) {
-            reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
-            return;
-        }
+            if (!s) {
+                reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+                return;
+            }
 
-        RetVal2<TrackId, AudioParams> result = s->addTrack(trackName, playbackData, params);
+            RetVal2<TrackId, AudioParams> result = s->addTrack(trackName, playbackData, params);
 
-        if (!result.ret) {
-            reject(result.ret.code(), result.ret.text());
-        }
+            if (!result.ret) {
+                reject(result.ret.code(), result.ret.text());
+            }
 
-        resolve(result.val1, result.val2);
+            resolve(result.val1, result.val2);
+        });
     }, AudioThread::ID);
 }
 
@@ -106,21 +109,23 @@ Promise<TrackId, AudioParams> TracksHandler::addTrack(const TrackSequenceId sequ
                                                                                              Promise<TrackId, AudioParams>::Reject reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, trackName, playbackData, params, resolve, reject]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (!s) {
-            reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
-            return;
-        }
+            if (!s) {
+                reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+                return;
+            }
 
-        RetVal2<TrackId, AudioParams> result = s->addTrack(trackName, playbackData, params);
+            RetVal2<TrackId, AudioParams> result = s->addTrack(trackName, playbackData, params);
 
-        if (!result.ret) {
-            reject(result.ret.code(), result.ret.text());
-            return;
-        }
+            if (!result.ret) {
+                reject(result.ret.code(), result.ret.text());
+                return;
+            }
 
-        resolve(result.val1, result.val2);
+            resolve(result.val1, result.val2);
+        });
     }, AudioThread::ID);
 }
 
@@ -129,13 +134,15 @@ void TracksHandler::removeTrack(const TrackSequenceId sequenceId, const TrackId
     Async::call(this, [this, sequenceId, trackId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, trackId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (!s) {
-            return;
-        }
+            if (!s) {
+                return;
+            }
 
-        s->removeTrack(trackId);
+            s->removeTrack(trackId);
+        });
     }, AudioThread::ID);
 }
 
@@ -144,15 +151,17 @@ void TracksHandler::removeAllTracks(const TrackSequenceId sequenceId)
     Async::call(this, [this, sequenceId]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (!s) {
-            return;
-        }
+            if (!s) {
+                return;
+            }
 
-        for (const TrackId& id : s->trackIdList()) {
-            s->removeTrack(id);
-        }
+            for (const TrackId& id : s->trackIdList()) {
+                s->removeTrack(id);
+            }
+        });
     }, AudioThread::ID);
 }
 
@@ -209,11 +218,13 @@ void TracksHandler::setInputParams(const TrackSequenceId sequenceId, const Track
     Async::call(this, [this, sequenceId, trackId, params]() {
         ONLY_AUDIO_WORKER_THREAD;
 
-        ITrackSequencePtr s = sequence(sequenceId);
+        AudioEngine::instance()->callInRealTimeMode([this, sequenceId, trackId, params]() {
+            ITrackSequencePtr s = sequence(sequenceId);
 
-        if (s) {
-            s->audioIO()->setInputParams(trackId, params);
-        }
+            if (s) {
+                s->audioIO()->setInputParams(trackId, params);
+            }
+        });
     }, AudioThread::ID);
 }
 
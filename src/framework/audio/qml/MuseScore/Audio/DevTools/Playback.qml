@@ -39,6 +39,10 @@ Rectangle {
         }
     }
 
+    AudioTelemetryModel {
+        id: telemetryModel
+    }
+
     Rectangle {
         id: backgroundRect
 
@@ -84,4 +88,48 @@ Rectangle {
             currentSignalAmplitude: waveModel.currentSignalAmplitude
         }
     }
+
+    Column {
+        id: telemetryColumn
+
+        anchors.top: contentRow.bottom
+        anchors.topMargin: 8
+        anchors.left: parent.left
+        anchors.leftMargin: 8
+        anchors.right: parent.right
+
+        spacing: 4
+
+        Row {
+            spacing: 8
+
+            StyledTextLabel {
+                anchors.verticalCenter: parent.verticalCenter
+                font: ui.theme.bodyBoldFont
+                text: "Buffer underruns: " + telemetryModel.bufferUnderrunCount
+                      + ", driver xruns: " + telemetryModel.driverXrunCount
+            }
+
+            FlatButton {
+                height: 30
+                text: "Reset"
+                onClicked: telemetryModel.reset()
+            }
+        }
+
+        StyledTextLabel {
+            horizontalAlignment: Text.AlignLeft
+            text: "Block time: count, deadline misses, avg/max us, histogram " + telemetryModel.histogramTitle
+        }
+
+        Repeater {
+            model: telemetryModel.stages
+
+            StyledTextLabel {
+                horizontalAlignment: Text.AlignLeft
+                text: modelData.name + ": " + modelData.blockCount + ", " + modelData.deadlineMissCount
+                      + ", " + modelData.avgTimeUs + "/" + modelData.maxTimeUs + ", " + modelData.histogram
+            }
+        }
+    }
 }
@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "audio/internal/audiotelemetry.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+class AudioTelemetryTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        AudioTelemetry::reset();
+        m_stage = AudioTelemetry::registerStage("test");
+        ASSERT_NE(m_stage, AudioTelemetry::INVALID_STAGE);
+    }
+
+    void TearDown() override
+    {
+        AudioTelemetry::unregisterStage(m_stage);
+    }
+
+    AudioProcessingStats stageStats() const
+    {
+        for (const AudioProcessingStats& stats : AudioTelemetry::data().stages) {
+            if (stats.name == "test") {
+                return stats;
+            }
+        }
+        return AudioProcessingStats();
+    }
+
+    AudioTelemetry::StageId m_stage = AudioTelemetry::INVALID_STAGE;
+};
+
+/**
+ * @brief AudioTelemetryTest_HistogramBuckets
+ * @details A block falls into the first bucket whose upper bound is greater than its time,
+ *          blocks slower than the last bound fall into the last (unbounded) bucket
+ */
+TEST_F(AudioTelemetryTest, HistogramBuckets)
+{
+    // [GIVEN] A large block, so that there are no deadline misses
+    const samples_t samples = 48000;
+    const unsigned int sampleRate = 48000;
+
+    // [WHEN] Blocks of these times (in ns) are processed
+    for (uint64_t timeNs : { 0ull, 49999ull, 50000ull, 999999ull, 1000000ull, 19999999ull, 20000000ull, 900000000ull }) {
+        AudioTelemetry::addBlock(m_stage, timeNs, samples, sampleRate);
+    }
+
+    // [THEN] The bounds are 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000 us
+    AudioTelemetryData data = AudioTelemetry::data();
+    ASSERT_EQ(data.histogramBoundsUs, std::vector<uint64_t>({ 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000 }));
+
+    // [THEN] The blocks are in the expected buckets
+    AudioProcessingStats stats = stageStats();
+    EXPECT_EQ(stats.histogram, std::vector<uint64_t>({ 2, 1, 0, 0, 1, 1, 0, 0, 1, 2 }));
+    EXPECT_EQ(stats.blockCount, 8u);
+    EXPECT_EQ(stats.maxTimeUs, 900000u);
+    EXPECT_EQ(stats.totalTimeUs, 942099u);
+    EXPECT_EQ(stats.deadlineMissCount, 0u);
+}
+
+/**
+ * @brief AudioTelemetryTest_DeadlineMisses
+ * @details A block is a deadline miss when it takes longer than the audio it produces
+ */
+TEST_F(AudioTelemetryTest, DeadlineMisses)
+{
+    // [GIVEN] 480 samples at 48kHz, which is exactly 10 ms of audio
+    const samples_t samples = 480;
+    const unsigned int sampleRate = 48000;
+
+    // [WHEN] A block takes exactly 10 ms
+    AudioTelemetry::addBlock(m_stage, 10000000, samples, sampleRate);
+
+    // [THEN] It is not a miss
+    EXPECT_EQ(stageStats().deadlineMissCount, 0u);
+
+    // [WHEN] Blocks take a bit longer
+    AudioTelemetry::addBlock(m_stage, 10000001, samples, sampleRate);
+    AudioTelemetry::addBlock(m_stage, 15000000, samples, sampleRate);
+
+    // [THEN] They are misses
+    EXPECT_EQ(stageStats().deadlineMissCount, 2u);
+
+    // [WHEN] The sample rate is unknown
+    AudioTelemetry::addBlock(m_stage, 15000000, samples, 0);
+
+    // [THEN] The block is counted, but not as a miss
+    AudioProcessingStats stats = stageStats();
+    EXPECT_EQ(stats.blockCount, 4u);
+    EXPECT_EQ(stats.deadlineMissCount, 2u);
+}
+
+/**
+ * @brief AudioTelemetryTest_XrunsAndReset
+ * @details Buffer underruns and driver xruns are counted globally, reset clears all the counters
+ *          but keeps the stages registered
+ */
+TEST_F(AudioTelemetryTest, XrunsAndReset)
+{
+    // [WHEN] There are underruns, xruns and a slow block
+    AudioTelemetry::addBufferUnderrun();
+    AudioTelemetry::addBufferUnderrun();
+    AudioTelemetry::addDriverXrun();
+    AudioTelemetry::addBlock(m_stage, 20000000, 480, 48000);
+
+    // [THEN] They are counted
+    AudioTelemetryData data = AudioTelemetry::data();
+    EXPECT_EQ(data.bufferUnderrunCount, 2u);
+    EXPECT_EQ(data.driverXrunCount, 1u);
+    EXPECT_EQ(stageStats().deadlineMissCount, 1u);
+
+    // [WHEN] The counters are reset
+    AudioTelemetry::reset();
+
+    // [THEN] Everything is zero, the stage is still there
+    data = AudioTelemetry::data();
+    EXPECT_EQ(data.bufferUnderrunCount, 0u);
+    EXPECT_EQ(data.driverXrunCount, 0u);
+
+    AudioProcessingStats stats = stageStats();
+    EXPECT_EQ(stats.name, "test");
+    EXPECT_EQ(stats.blockCount, 0u);
+    EXPECT_EQ(stats.deadlineMissCount, 0u);
+    EXPECT_EQ(stats.histogram, std::vector<uint64_t>(10, 0));
+}
+
+/**
+ * @brief AudioTelemetryTest_UnregisteredStage
+ * @details Blocks of an invalid stage are ignored, an unregistered stage is not reported
+ */
+TEST_F(AudioTelemetryTest, UnregisteredStage)
+{
+    AudioTelemetry::addBlock(AudioTelemetry::INVALID_STAGE, 1000, 480, 48000);
+    AudioTelemetry::addBlock(100000, 1000, 480, 48000);
+
+    AudioTelemetry::unregisterStage(m_stage);
+    EXPECT_TRUE(stageStats().name.empty());
+
+    // [THEN] A new stage reuses the slot, with clean counters
+    AudioTelemetry::addBlock(m_stage, 1000, 480, 48000);
+    m_stage = AudioTelemetry::registerStage("test");
+    EXPECT_EQ(stageStats().blockCount, 0u);
+}
@@ -0,0 +1,192 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "audio/internal/worker/mixer.h"
+#include "audio/internal/worker/mixerchannel.h"
+#include "audio/internal/audiosanitizer.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+static constexpr unsigned int SAMPLE_RATE = 44100;
+static constexpr audioch_t AUDIO_CHANNELS_COUNT = 2;
+static constexpr samples_t BLOCK_SIZE = 512;
+static constexpr int BLOCKS_COUNT = 16;
+static constexpr TrackId TRACKS_COUNT = 4;
+
+//! NOTE The same stereo sine for the same track every time, so the renders can be compared
+class SineAudioSource : public AbstractAudioSource
+{
+public:
+    explicit SineAudioSource(const TrackId trackId)
+        : m_frequency(220.f * (trackId + 1)), m_amplitude(0.1f + 0.05f * trackId)
+    {
+    }
+
+    unsigned int audioChannelsCount() const override
+    {
+        return AUDIO_CHANNELS_COUNT;
+    }
+
+    samples_t process(float* buffer, samples_t samplesPerChannel) override
+    {
+        for (samples_t s = 0; s < samplesPerChannel; ++s) {
+            float sample = m_amplitude * std::sin(2.f * static_cast<float>(M_PI) * m_frequency * m_position / m_sampleRate);
+
+            buffer[s * AUDIO_CHANNELS_COUNT] = sample;
+            buffer[s * AUDIO_CHANNELS_COUNT + 1] = -sample;
+
+            ++m_position;
+        }
+
+        return samplesPerChannel;
+    }
+
+private:
+    float m_frequency = 0.f;
+    float m_amplitude = 0.f;
+    samples_t m_position = 0;
+};
+
+class MixerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+    }
+
+    MixerPtr makeMixer(const RenderMode mode) const
+    {
+        MixerPtr mixer = std::make_shared<Mixer>();
+        mixer->setAudioChannelsCount(AUDIO_CHANNELS_COUNT);
+        mixer->setSampleRate(SAMPLE_RATE);
+        mixer->setMode(mode);
+
+        for (TrackId trackId = 0; trackId < TRACKS_COUNT; ++trackId) {
+            EXPECT_TRUE(mixer->addChannel(trackId, std::make_shared<SineAudioSource>(trackId)).ret);
+        }
+
+        return mixer;
+    }
+
+    std::vector<float> makeBuffer() const
+    {
+        return std::vector<float>(BLOCK_SIZE * AUDIO_CHANNELS_COUNT, 0.f);
+    }
+};
+
+/**
+ * @brief MixerTest_OfflineOutputEqualsRealTime
+ * @details The offline mode renders the channels in parallel, each into its own buffer,
+ *          but mixes them in the same order, so the output must be exactly the same as in real time
+ */
+TEST_F(MixerTest, OfflineOutputEqualsRealTime)
+{
+    // [GIVEN] Two mixers with the same channels, one of them in the offline mode
+    MixerPtr realTimeMixer = makeMixer(RenderMode::RealTimeMode);
+    MixerPtr offlineMixer = makeMixer(RenderMode::OfflineMode);
+
+    std::vector<float> realTimeOutput = makeBuffer();
+    std::vector<float> offlineOutput = makeBuffer();
+
+    for (int block = 0; block < BLOCKS_COUNT; ++block) {
+        // [WHEN] Both process the same block
+        samples_t realTimeSamples = realTimeMixer->process(realTimeOutput.data(), BLOCK_SIZE);
+        samples_t offlineSamples = offlineMixer->process(offlineOutput.data(), BLOCK_SIZE);
+
+        // [THEN] The outputs are the same
+        EXPECT_EQ(realTimeSamples, BLOCK_SIZE);
+        EXPECT_EQ(offlineSamples, realTimeSamples);
+        ASSERT_EQ(offlineOutput, realTimeOutput) << "block " << block;
+    }
+}
+
+/**
+ * @brief MixerTest_ChannelOutput
+ * @details The output of the channel in the offline mode is the one of the same channel processed alone
+ */
+TEST_F(MixerTest, ChannelOutput)
+{
+    // [GIVEN] The offline mixer and a separate channel with the same source as the track 1
+    MixerPtr mixer = makeMixer(RenderMode::OfflineMode);
+    MixerChannel channel(1, std::make_shared<SineAudioSource>(1), SAMPLE_RATE);
+
+    std::vector<float> output = makeBuffer();
+    std::vector<float> channelOutput = makeBuffer();
+
+    for (int block = 0; block < BLOCKS_COUNT; ++block) {
+        // [WHEN] Both process the same block
+        mixer->process(output.data(), BLOCK_SIZE);
+        channel.process(channelOutput.data(), BLOCK_SIZE);
+
+        // [THEN] The mixer keeps the output of the channel
+        const float* trackOutput = mixer->channelOutput(1);
+        ASSERT_NE(trackOutput, nullptr);
+        ASSERT_EQ(std::vector<float>(trackOutput, trackOutput + channelOutput.size()), channelOutput) << "block " << block;
+    }
+
+    // [THEN] There is no output for an unknown track
+    EXPECT_EQ(mixer->channelOutput(TRACKS_COUNT), nullptr);
+}
+
+/**
+ * @brief MixerTest_StemSum
+ * @details The stem is the sum of the outputs of its channels, the unknown tracks are skipped
+ */
+TEST_F(MixerTest, StemSum)
+{
+    // [GIVEN] The offline mixer
+    MixerPtr mixer = makeMixer(RenderMode::OfflineMode);
+
+    std::vector<float> output = makeBuffer();
+    std::vector<float> stem = makeBuffer();
+    std::vector<float> emptyStem = makeBuffer();
+
+    TrackIdList stemTrackIds = { 0, 2, TRACKS_COUNT };
+
+    for (int block = 0; block < BLOCKS_COUNT; ++block) {
+        // [WHEN] The block is processed and the stems are mixed
+        mixer->process(output.data(), BLOCK_SIZE);
+        mixer->mixTracksOutput(stemTrackIds, stem.data(), BLOCK_SIZE);
+
+        std::fill(emptyStem.begin(), emptyStem.end(), 1.f);
+        mixer->mixTracksOutput({ TRACKS_COUNT }, emptyStem.data(), BLOCK_SIZE);
+
+        // [THEN] The stem is the sum of the channels
+        const float* firstOutput = mixer->channelOutput(0);
+        const float* secondOutput = mixer->channelOutput(2);
+        ASSERT_NE(firstOutput, nullptr);
+        ASSERT_NE(secondOutput, nullptr);
+
+        for (size_t i = 0; i < stem.size(); ++i) {
+            ASSERT_FLOAT_EQ(stem[i], firstOutput[i] + secondOutput[i]) << "block " << block << ", sample " << i;
+        }
+
+        // [THEN] The stem without known tracks is silent
+        EXPECT_EQ(emptyStem, std::vector<float>(emptyStem.size(), 0.f));
+    }
+}
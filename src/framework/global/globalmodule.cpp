@@ -53,6 +53,8 @@ static std::shared_ptr<GlobalConfiguration> s_globalConf = std::make_shared<Glob
 
 static Invoker s_asyncInvoker;
 
+static const Settings::Key ASYNC_LOGGING_KEY("global", "application/logger/async");
+
 std::string GlobalModule::moduleName() const
 {
     return "global";
@@ -105,6 +107,12 @@ void GlobalModule::onInit(const IApplication::RunMode&)
     logger->setLevel(haw::logger::Normal);
 #endif
 
+    //! NOTE Opt-in: formatting and writing to the file are then done in a background thread,
+    //! so logging does not block the audio and layout threads. Errors are still written at once
+    settings()->setDefaultValue(ASYNC_LOGGING_KEY, mu::Val(false));
+    settings()->setCanBeMannualyEdited(ASYNC_LOGGING_KEY, true);
+    logger->setIsAsync(settings()->value(ASYNC_LOGGING_KEY).toBool());
+
     LOGI() << "=== Started MuseScore " << framework::Version::fullVersion() << " ===";
 
     //! --- Setup profiler ---
@@ -146,3 +154,9 @@ void GlobalModule::onInit(const IApplication::RunMode&)
         pr->reg("settings file", settings()->filePath());
     }
 }
+
+void GlobalModule::onDeinit()
+{
+    //! NOTE Write the queued messages
+    haw::logger::Logger::instance()->setIsAsync(false);
+}
@@ -0,0 +1,247 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "log.h"
+#include "thirdparty/haw_logger/logger/logdefdest.h"
+
+using namespace haw::logger;
+
+namespace mu {
+class LoggerTests : public ::testing::Test
+{
+public:
+    //! NOTE Counts messages and simulates the formatting and I/O cost of a real destination.
+    //! While the gate is closed, a write blocks (and so does the writer thread of the async mode)
+    class CountLogDest : public LogDest
+    {
+    public:
+        CountLogDest(std::atomic<int>& count, std::atomic<int>& dropReports, std::atomic<bool>& gateClosed,
+                     std::atomic<bool>& blocked)
+            : LogDest(LogLayout("${time} | ${type|5} | ${thread} | ${tag|10} | ${message}")),
+            m_count(count), m_dropReports(dropReports), m_gateClosed(gateClosed), m_blocked(blocked) {}
+
+        std::string name() const override { return "CountLogDest"; }
+
+        void write(const LogMsg& logMsg) override
+        {
+            while (m_gateClosed.load()) {
+                m_blocked.store(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            m_blocked.store(false);
+
+            std::string str = m_layout.output(logMsg);
+            if (logMsg.tag == "Logger") {
+                ++m_dropReports;
+                return;
+            }
+
+            m_size += str.size();
+            ++m_count;
+        }
+
+    private:
+        std::atomic<int>& m_count;
+        std::atomic<int>& m_dropReports;
+        std::atomic<bool>& m_gateClosed;
+        std::atomic<bool>& m_blocked;
+        size_t m_size = 0;
+    };
+
+    void SetUp() override
+    {
+        m_logger = Logger::instance();
+        m_logger->clearDests();
+        m_logger->addDest(new CountLogDest(m_count, m_dropReports, m_gateClosed, m_destBlocked));
+        m_logger->setLevel(Normal);
+    }
+
+    void TearDown() override
+    {
+        m_logger->setIsAsync(false);
+        m_logger->setupDefault();
+    }
+
+    void writeFromThreads(int threadCount, int msgCount)
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([msgCount, t]() {
+                for (int i = 0; i < msgCount; ++i) {
+                    LOGI() << "thread: " << t << ", message: " << i;
+                }
+            });
+        }
+
+        for (std::thread& th : threads) {
+            th.join();
+        }
+    }
+
+    Logger* m_logger = nullptr;
+    std::atomic<int> m_count { 0 };
+    std::atomic<int> m_dropReports { 0 };
+    std::atomic<bool> m_gateClosed { false };
+    std::atomic<bool> m_destBlocked { false };
+};
+
+/**
+ * @brief LoggerTests_Async
+ * @details In the async mode all messages are written by the background thread, if the queues are large enough
+ */
+TEST_F(LoggerTests, Async)
+{
+    m_logger->setIsAsync(true, 100000);
+    EXPECT_TRUE(m_logger->isAsync());
+
+    writeFromThreads(4, 1000);
+    m_logger->flush();
+
+    EXPECT_EQ(m_count.load(), 4000);
+    EXPECT_EQ(m_logger->droppedCount(), uint64_t(0));
+
+    //! NOTE Switching off writes the rest and returns to the sync mode
+    LOGI() << "queued";
+    m_logger->setIsAsync(false);
+    EXPECT_FALSE(m_logger->isAsync());
+    EXPECT_EQ(m_count.load(), 4001);
+
+    LOGI() << "sync";
+    EXPECT_EQ(m_count.load(), 4002);
+}
+
+/**
+ * @brief LoggerTests_AsyncDropped
+ * @details Messages that do not fit into a full queue are dropped, counted and reported
+ */
+TEST_F(LoggerTests, AsyncDropped)
+{
+    // [GIVEN] The async mode with a queue of 4 messages, and the writer thread blocked in the destination
+    m_logger->setIsAsync(true, 4);
+
+    m_gateClosed = true;
+    LOGI() << "blocks the writer";
+    while (!m_destBlocked.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // [WHEN] More messages are written than the queue can hold (the blocking one still takes a place)
+    for (int i = 0; i < 13; ++i) {
+        LOGI() << "message: " << i;
+    }
+
+    // [THEN] The rest of them are dropped
+    EXPECT_EQ(m_logger->droppedCount(), uint64_t(10));
+
+    // [WHEN] The writer is unblocked and the async mode is switched off
+    m_gateClosed = false;
+    m_logger->setIsAsync(false);
+
+    // [THEN] The queued messages are written, and the drop is reported
+    EXPECT_EQ(m_count.load(), 4);
+    EXPECT_EQ(m_logger->droppedCount(), uint64_t(10));
+    EXPECT_EQ(m_dropReports.load(), 1);
+}
+
+/**
+ * @brief LoggerTests_AsyncError
+ * @details Errors are written at once in the async mode, after the messages queued before them
+ */
+TEST_F(LoggerTests, AsyncError)
+{
+    m_logger->setIsAsync(true, 1000);
+
+    for (int i = 0; i < 10; ++i) {
+        LOGI() << "message: " << i;
+    }
+
+    LOGE() << "error";
+    EXPECT_EQ(m_count.load(), 11);
+}
+
+/**
+ * @brief LoggerTests_AsyncSwitchOff
+ * @details Switching the async mode off while other threads are logging doesn't lose messages
+ */
+TEST_F(LoggerTests, AsyncSwitchOff)
+{
+    m_logger->setIsAsync(true, 100000);
+
+    std::thread switchOff([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        m_logger->setIsAsync(false);
+    });
+
+    writeFromThreads(4, 20000);
+    switchOff.join();
+
+    EXPECT_FALSE(m_logger->isAsync());
+    EXPECT_EQ(m_logger->droppedCount(), uint64_t(0));
+    EXPECT_EQ(m_count.load(), 80000);
+}
+
+/**
+ * @brief LoggerTests_DISABLED_Benchmark
+ * @details Throughput of log-heavy threads writing to a log file, sync vs async mode.
+ *          Run with --gtest_also_run_disabled_tests
+ */
+TEST_F(LoggerTests, DISABLED_Benchmark)
+{
+    const int threadCount = 8;
+    const int msgCount = 20000;
+
+    std::string logFilePath = (std::filesystem::temp_directory_path() / "logger_tests_benchmark.log").string();
+    m_logger->addDest(new FileLogDest(logFilePath, LogLayout("${datetime} | ${type|5} | ${thread} | ${tag|10} | ${message}")));
+
+    auto measure = [this, threadCount, msgCount](bool isAsync) {
+        m_count = 0;
+        m_logger->setIsAsync(isAsync, 4096);
+
+        auto start = std::chrono::steady_clock::now();
+        writeFromThreads(threadCount, msgCount);
+        auto end = std::chrono::steady_clock::now();
+
+        m_logger->setIsAsync(false);
+
+        std::chrono::duration<double, std::milli> elapsed = end - start;
+        std::cout << (isAsync ? "async: " : "sync: ") << elapsed.count() << " ms in the producer threads"
+                  << ", written: " << m_count.load() << ", dropped: " << (threadCount * msgCount - m_count.load())
+                  << std::endl;
+    };
+
+    measure(false);
+    measure(true);
+
+    m_logger->clearDests();
+    std::remove(logFilePath.c_str());
+}
+}
@@ -36,6 +36,12 @@ public:
 
     virtual int exportMp3Bitrate() = 0;
     virtual void setExportMp3Bitrate(std::optional<int> bitrate) = 0;
+
+    virtual double exportOggQuality() = 0;
+    virtual void setExportOggQuality(std::optional<double> quality) = 0;
+
+    virtual int exportSampleRate() = 0;
+    virtual void setExportSampleRate(std::optional<int> sampleRate) = 0;
 };
 }
 
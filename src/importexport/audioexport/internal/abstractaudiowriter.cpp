@@ -21,11 +21,16 @@
  */
 #include "abstractaudiowriter.h"
 
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+
 #include "log.h"
 
 using namespace mu::iex::audioexport;
 using namespace mu::project;
 using namespace mu::notation;
+using namespace mu::audio;
 
 std::vector<INotationWriter::UnitType> AbstractAudioWriter::supportedUnitTypes() const
 {
@@ -38,9 +43,14 @@ bool AbstractAudioWriter::supportsUnitType(UnitType unitType) const
     return std::find(unitTypes.cbegin(), unitTypes.cend(), unitType) != unitTypes.cend();
 }
 
-mu::Ret AbstractAudioWriter::write(INotationPtr, io::Device&, const Options& options)
+mu::Ret AbstractAudioWriter::write(INotationPtr notation, io::Device& destinationDevice, const Options& options)
 {
-    IF_ASSERT_FAILED(unitTypeFromOptions(options) != UnitType::MULTI_PART) {
+    return writeParts({ notation }, { &destinationDevice }, options);
+}
+
+mu::Ret AbstractAudioWriter::writeList(const INotationPtrList&, io::Device&, const Options& options)
+{
+    IF_ASSERT_FAILED(unitTypeFromOptions(options) == UnitType::MULTI_PART) {
         return Ret(Ret::Code::NotSupported);
     }
 
@@ -53,24 +63,59 @@ mu::Ret AbstractAudioWriter::write(INotationPtr, io::Device&, const Options& opt
     return Ret(Ret::Code::NotSupported);
 }
 
-mu::Ret AbstractAudioWriter::writeList(const INotationPtrList&, io::Device&, const Options& options)
+bool AbstractAudioWriter::supportsWritingPartsAtOnce() const
 {
-    IF_ASSERT_FAILED(unitTypeFromOptions(options) == UnitType::MULTI_PART) {
+    return true;
+}
+
+mu::Ret AbstractAudioWriter::writeParts(const INotationPtrList& notations, const std::vector<io::Device*>& destinationDevices,
+                                        const Options& options)
+{
+    IF_ASSERT_FAILED(unitTypeFromOptions(options) != UnitType::MULTI_PART) {
         return Ret(Ret::Code::NotSupported);
     }
 
-    if (supportsUnitType(static_cast<UnitType>(options.value(OptionKey::UNIT_TYPE, Val(0)).toInt()))) {
-        NOT_IMPLEMENTED;
-        return Ret(Ret::Code::NotImplemented);
+    if (!supportsUnitType(static_cast<UnitType>(options.value(OptionKey::UNIT_TYPE, Val(0)).toInt()))) {
+        NOT_SUPPORTED;
+        return Ret(Ret::Code::NotSupported);
     }
 
-    NOT_SUPPORTED;
-    return Ret(Ret::Code::NotSupported);
+    IF_ASSERT_FAILED(notations.size() == destinationDevices.size()) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    //! NOTE The score is rendered once, every part gets the stem of its own tracks, the main score gets the whole mix
+    SoundTrackStemList stems;
+
+    for (size_t i = 0; i < notations.size(); ++i) {
+        //! NOTE The soundtrack is rendered and encoded on the audio worker thread, which must not use the QIODevice,
+        //! so the worker writes the file by its path
+        QFile* file = qobject_cast<QFile*>(destinationDevices[i]);
+        IF_ASSERT_FAILED(file && notations[i]) {
+            return make_ret(Ret::Code::NotSupported);
+        }
+
+        SoundTrackStem stem;
+        stem.destination = QFileInfo(*file).absoluteFilePath();
+
+        if (!notations[i]->elements()->msScore()->isMaster()) {
+            stem.trackIds = playbackController()->notationTrackIdList(notations[i]);
+
+            //! NOTE The stem without tracks would be the whole mix
+            IF_ASSERT_FAILED(!stem.trackIds.empty()) {
+                return make_ret(Ret::Code::InternalError);
+            }
+        }
+
+        stems.push_back(std::move(stem));
+    }
+
+    return doWriteAndWait(stems, soundTrackFormat());
 }
 
 void AbstractAudioWriter::abort()
 {
-    NOT_IMPLEMENTED;
+    playback()->audioOutput()->abortSavingAllSoundTracks();
 }
 
 mu::framework::ProgressChannel AbstractAudioWriter::progress() const
@@ -93,3 +138,35 @@ INotationWriter::UnitType AbstractAudioWriter::unitTypeFromOptions(const Options
 
     return unitType;
 }
+
+mu::Ret AbstractAudioWriter::doWriteAndWait(const SoundTrackStemList& stems, const SoundTrackFormat& format)
+{
+    Ret result = make_ret(Ret::Code::Ok);
+    bool isFinished = false;
+    QEventLoop loop;
+
+    playback()->audioOutput()->saveSoundTrackProgress().onReceive(this, [this](const framework::Progress& progress) {
+        m_progress.send(progress);
+    });
+
+    //! NOTE The main thread keeps processing the events: the worker requests the notation events from it while rendering
+    playback()->audioOutput()->saveSoundTrackStems(playbackController()->currentTrackSequenceId(), stems, format)
+    .onResolve(this, [&isFinished, &loop](const bool) {
+        isFinished = true;
+        loop.quit();
+    })
+    .onReject(this, [&result, &isFinished, &loop](int code, const std::string& msg) {
+        LOGE() << "can't save the soundtrack, code: [" << code << "] " << msg;
+        result = Ret(code, msg);
+        isFinished = true;
+        loop.quit();
+    });
+
+    if (!isFinished) {
+        loop.exec();
+    }
+
+    playback()->audioOutput()->saveSoundTrackProgress().resetOnReceive(this);
+
+    return result;
+}
@@ -24,9 +24,21 @@
 
 #include "project/inotationwriter.h"
 
+#include "modularity/ioc.h"
+#include "async/asyncable.h"
+#include "audio/iplayback.h"
+#include "audio/audiotypes.h"
+#include "playback/iplaybackcontroller.h"
+
+#include "../iaudioexportconfiguration.h"
+
 namespace mu::iex::audioexport {
-class AbstractAudioWriter : public project::INotationWriter
+class AbstractAudioWriter : public project::INotationWriter, public async::Asyncable
 {
+    INJECT(iex_audioexport, audio::IPlayback, playback)
+    INJECT(iex_audioexport, playback::IPlaybackController, playbackController)
+    INJECT(iex_audioexport, IAudioExportConfiguration, configuration)
+
 public:
     AbstractAudioWriter() = default;
     virtual ~AbstractAudioWriter() = default;
@@ -37,11 +49,19 @@ public:
     Ret write(notation::INotationPtr notation, io::Device& destinationDevice, const Options& options = Options()) override;
     Ret writeList(const notation::INotationPtrList& notations, io::Device& destinationDevice, const Options& options = Options()) override;
 
+    bool supportsWritingPartsAtOnce() const override;
+    Ret writeParts(const notation::INotationPtrList& notations, const std::vector<io::Device*>& destinationDevices,
+                   const Options& options = Options()) override;
+
     void abort() override;
     framework::ProgressChannel progress() const override;
 
 protected:
+    virtual audio::SoundTrackFormat soundTrackFormat() const = 0;
+
     UnitType unitTypeFromOptions(const Options& options) const;
+    Ret doWriteAndWait(const audio::SoundTrackStemList& stems, const audio::SoundTrackFormat& format);
+
     framework::ProgressChannel m_progress;
 };
 }
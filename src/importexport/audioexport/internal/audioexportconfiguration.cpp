@@ -25,6 +25,8 @@
 using namespace mu::iex::audioexport;
 
 static constexpr int DEFAULT_BITRATE = 128;
+static constexpr double DEFAULT_OGG_QUALITY = 0.4; //! NOTE About 128 kbit/s
+static constexpr int DEFAULT_SAMPLE_RATE = 44100;
 
 int AudioExportConfiguration::exportMp3Bitrate()
 {
@@ -35,3 +37,23 @@ void AudioExportConfiguration::setExportMp3Bitrate(std::optional<int> bitrate)
 {
     m_exportMp3Bitrate = bitrate;
 }
+
+double AudioExportConfiguration::exportOggQuality()
+{
+    return m_exportOggQuality ? m_exportOggQuality.value() : DEFAULT_OGG_QUALITY;
+}
+
+void AudioExportConfiguration::setExportOggQuality(std::optional<double> quality)
+{
+    m_exportOggQuality = quality;
+}
+
+int AudioExportConfiguration::exportSampleRate()
+{
+    return m_exportSampleRate ? m_exportSampleRate.value() : DEFAULT_SAMPLE_RATE;
+}
+
+void AudioExportConfiguration::setExportSampleRate(std::optional<int> sampleRate)
+{
+    m_exportSampleRate = sampleRate;
+}
@@ -31,8 +31,16 @@ public:
     int exportMp3Bitrate() override;
     void setExportMp3Bitrate(std::optional<int> bitrate) override;
 
+    double exportOggQuality() override;
+    void setExportOggQuality(std::optional<double> quality) override;
+
+    int exportSampleRate() override;
+    void setExportSampleRate(std::optional<int> sampleRate) override;
+
 private:
     std::optional<int> m_exportMp3Bitrate = std::nullopt;
+    std::optional<double> m_exportOggQuality = std::nullopt;
+    std::optional<int> m_exportSampleRate = std::nullopt;
 };
 }
 
@@ -25,15 +25,13 @@
 #include "log.h"
 
 using namespace mu::iex::audioexport;
-using namespace mu::framework;
 
-mu::Ret Mp3Writer::write(notation::INotationPtr notation, io::Device& destinationDevice, const Options& options)
+mu::audio::SoundTrackFormat Mp3Writer::soundTrackFormat() const
 {
-    UNUSED(notation)
-    UNUSED(destinationDevice)
-    UNUSED(options)
+    audio::SoundTrackFormat format;
+    format.type = audio::SoundTrackType::MP3;
+    format.sampleRate = static_cast<unsigned int>(configuration()->exportSampleRate());
+    format.bitRate = configuration()->exportMp3Bitrate();
 
-    NOT_IMPLEMENTED;
-
-    return make_ret(Ret::Code::NotImplemented);
+    return format;
 }
@@ -25,15 +25,13 @@
 #include "log.h"
 
 using namespace mu::iex::audioexport;
-using namespace mu::io;
 
-mu::Ret OggWriter::write(notation::INotationPtr notation, Device& destinationDevice, const Options& options)
+mu::audio::SoundTrackFormat OggWriter::soundTrackFormat() const
 {
-    UNUSED(notation)
-    UNUSED(destinationDevice)
-    UNUSED(options)
+    audio::SoundTrackFormat format;
+    format.type = audio::SoundTrackType::OGG;
+    format.sampleRate = static_cast<unsigned int>(configuration()->exportSampleRate());
+    format.quality = configuration()->exportOggQuality();
 
-    NOT_IMPLEMENTED;
-
-    return make_ret(Ret::Code::NotImplemented);
+    return format;
 }
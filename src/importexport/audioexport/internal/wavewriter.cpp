@@ -25,15 +25,12 @@
 #include "log.h"
 
 using namespace mu::iex::audioexport;
-using namespace mu::framework;
 
-mu::Ret WaveWriter::write(notation::INotationPtr notation, io::Device& destinationDevice, const Options& options)
+mu::audio::SoundTrackFormat WaveWriter::soundTrackFormat() const
 {
-    UNUSED(notation)
-    UNUSED(destinationDevice)
-    UNUSED(options)
+    audio::SoundTrackFormat format;
+    format.type = audio::SoundTrackType::WAV;
+    format.sampleRate = static_cast<unsigned int>(configuration()->exportSampleRate());
 
-    NOT_IMPLEMENTED;
-
-    return make_ret(Ret::Code::NotImplemented);
+    return format;
 }
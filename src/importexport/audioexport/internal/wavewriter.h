@@ -28,8 +28,8 @@
 namespace mu::iex::audioexport {
 class WaveWriter : public AbstractAudioWriter
 {
-public:
-    Ret write(notation::INotationPtr notation, io::Device& destinationDevice, const Options& options = Options()) override;
+protected:
+    audio::SoundTrackFormat soundTrackFormat() const override;
 };
 }
 
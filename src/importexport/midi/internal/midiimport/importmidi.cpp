@@ -22,6 +22,7 @@
 
 #include <set>
 
+#include <QElapsedTimer>
 #include <QMessageBox>
 
 #include "engraving/compat/midi/midifile.h"
@@ -80,6 +81,8 @@
 #include "importmidi_instrument.h"
 #include "importmidi_chordname.h"
 
+#include "log.h"
+
 using namespace mu::engraving;
 
 namespace Ms {
@@ -233,23 +236,27 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
 {
     auto& opers = midiImportOperations;
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        if (mtrack.chords.empty()) {
-            continue;
-        }
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
-
-        if (opers.data()->processingsOfOpenedFile == 0) {
+    if (opers.data()->processingsOfOpenedFile == 0) {
+        for (auto& track: tracks) {
+            const MTrack& mtrack = track.second;
+            if (mtrack.chords.empty()) {
+                continue;
+            }
             opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
+                mtrack.indexOfOperation, mtrack.mtrack->drumTrack());
             if (mtrack.mtrack->drumTrack()) {
                 opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
+                    mtrack.indexOfOperation, MidiOperations::VoiceCount::V_1);
             }
         }
+    }
+
+    // track operations are not modified from now, so tracks
+    // can be quantized independently of each other
+    MidiTracks::processConcurrently(tracks, [&opers, sigmap, &lastTick](MTrack& mtrack) {
+        if (mtrack.chords.empty()) {
+            return;
+        }
         const auto basicQuant = Quantize::quantValueToFraction(
             opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
 #ifdef QT_DEBUG
@@ -264,7 +271,7 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
             MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
         }
 #ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
+        Q_ASSERT_X(!doNotesOverlap(mtrack),
                    "quantizeAllTracks",
                    "There are overlapping notes of the same voice that is incorrect");
 #endif
@@ -278,7 +285,7 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
                    "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
                                         "or non-tuplet chord/note is inside tuplet");
 #endif
-    }
+    });
 }
 
 //---------------------------------------------------------
@@ -1110,11 +1117,42 @@ ReducedFraction findLastChordTick(const std::multimap<int, MTrack>& tracks)
     return lastTick;
 }
 
+//! NOTE Each stage of the conversion is timed in the import log (not only in the profiler, which is usually off),
+//! so the log of a slow import shows which stage it was
+class ConvertStageTimer
+{
+public:
+    ConvertStageTimer()
+    {
+        BEGIN_STEP_TIME("convertMidi");
+        m_stageTimer.start();
+        m_totalTimer.start();
+    }
+
+    void step(const char* stage)
+    {
+        STEP_TIME("convertMidi", stage);
+        LOGI() << "MIDI import stage \"" << stage << "\": " << m_stageTimer.restart() << " ms";
+    }
+
+    void finish()
+    {
+        LOGI() << "MIDI import stages took " << m_totalTimer.elapsed() << " ms in total";
+    }
+
+private:
+    QElapsedTimer m_stageTimer;
+    QElapsedTimer m_totalTimer;
+};
+
 QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
 {
+    ConvertStageTimer stageTimer;
+
     auto* sigmap = score->sigmap();
 
     auto tracks = createMTrackList(sigmap, mf);
+    stageTimer.step("create tracks");
 
     auto& opers = midiImportOperations;
     if (opers.data()->processingsOfOpenedFile == 0) {         // for newly opened MIDI file
@@ -1139,6 +1177,7 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     } else {      // user value
         MidiBeat::setTimeSignature(sigmap);
     }
+    stageTimer.step("detect human performance and beats");
 
     Q_ASSERT_X((opers.data()->trackOpers.isHumanPerformance.value())
                ? Meter::userTimeSigToFraction(opers.data()->trackOpers.timeSigNumerator.value(),
@@ -1149,6 +1188,7 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     MChord::collectChords(tracks, { 2, 1 }, { 1, 2 });
     MidiBeat::adjustChordsToBeats(tracks);
     MChord::mergeChordsWithEqualOnTimeAndVoice(tracks);
+    stageTimer.step("collect chords and adjust to beats");
 
     // for newly opened MIDI file
     if (opers.data()->processingsOfOpenedFile == 0
@@ -1164,8 +1204,10 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     LRHand::splitIntoLeftRightHands(tracks);
     MidiDrum::splitDrumVoices(tracks);
     MidiDrum::splitDrumTracks(tracks);
+    stageTimer.step("split left/right hands and drums");
     ReducedFraction lastTick = findLastChordTick(tracks);
     quantizeAllTracks(tracks, sigmap, lastTick);
+    stageTimer.step("quantize and find tuplets");
     MChord::removeOverlappingNotes(tracks);
 #ifdef QT_DEBUG
     Q_ASSERT_X(!doNotesOverlap(tracks),
@@ -1175,17 +1217,22 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
 #endif
     MChord::mergeChordsWithEqualOnTimeAndVoice(tracks);
     Simplify::simplifyDurationsNotDrums(tracks, sigmap);
-    if (MidiVoice::separateVoices(tracks, sigmap)) {
+    stageTimer.step("simplify durations");
+    const bool voicesChanged = MidiVoice::separateVoices(tracks, sigmap);
+    stageTimer.step("separate voices");
+    if (voicesChanged) {
         Simplify::simplifyDurationsNotDrums(tracks, sigmap);        // again
     }
     Simplify::simplifyDurationsForDrums(tracks, sigmap);
     MChord::splitUnequalChords(tracks);
+    stageTimer.step("simplify durations again");
     // no more track insertion/reordering/deletion from now
     QList<MTrack> trackList = prepareTrackList(tracks);
     MidiInstr::setGrandStaffProgram(trackList);
     MidiInstr::findInstrumentsForAllTracks(trackList);
     MidiInstr::createInstruments(score, trackList);
     MidiDrum::setStaffBracketForDrums(trackList);
+    stageTimer.step("find instruments");
 
     const auto firstTick = findFirstChordTick(trackList);
 
@@ -1195,6 +1242,7 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     createKeys(trackList);
     MidiKey::recognizeMainKeySig(trackList);
     createNotes(lastTick, trackList);
+    stageTimer.step("create notes");
     processLyricMeta(trackList);
     applySwing(trackList);
     createClefs(trackList);
@@ -1204,6 +1252,8 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     MidiLyrics::setLyricsToScore(trackList);
     MidiTempo::setTempo(tracks, score);
     MidiChordName::setChordNames(trackList);
+    stageTimer.step("create lyrics, clefs, tempo and chord names");
+    stageTimer.finish();
 
     return trackList;
 }
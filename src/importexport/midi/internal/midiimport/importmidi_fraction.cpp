@@ -98,6 +98,14 @@ namespace {
 
 static unsigned lcm(int a, int b)
 {
+    // one value divides the other: the lcm is the other one, no gcd needed
+    if (a != 0 && b % a == 0) {
+        return b >= 0 ? b : -b;
+    }
+    if (b != 0 && a % b == 0) {
+        return a >= 0 ? a : -a;
+    }
+
     const int g =  Ms::gcd(a, b);
 
 #ifdef QT_DEBUG
@@ -134,7 +142,11 @@ ReducedFraction::ReducedFraction(const Fraction& fraction)
 
 ReducedFraction ReducedFraction::fromTicks(int ticks)
 {
-    return ReducedFraction(ticks, MScore::division * 4).reduced();
+    const int wholeTicks = MScore::division * 4;
+    if (ticks % wholeTicks == 0) {
+        return ReducedFraction(ticks / wholeTicks, 1);
+    }
+    return ReducedFraction(ticks, wholeTicks).reduced();
 }
 
 ReducedFraction ReducedFraction::reduced() const
@@ -303,46 +315,48 @@ ReducedFraction& ReducedFraction::operator/=(int val)
     return *this;
 }
 
+namespace {
+// Compare values the same way as Fraction does: 64 bit cross-multiplication,
+// without computing lcm and gcd. The order is reversed if exactly one
+// of the denominators is negative.
+
+int compare(const ReducedFraction& f1, const ReducedFraction& f2)
+{
+    const int_least64_t v1 = static_cast<int_least64_t>(f1.numerator()) * f2.denominator();
+    const int_least64_t v2 = static_cast<int_least64_t>(f2.numerator()) * f1.denominator();
+    const int sign = ((f1.denominator() < 0) != (f2.denominator() < 0)) ? -1 : 1;
+    return (v1 < v2) ? -sign : ((v1 > v2) ? sign : 0);
+}
+}
+
 bool ReducedFraction::operator<(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           < fractionPart(v, val.numerator_, val.denominator_);
+    return compare(*this, val) < 0;
 }
 
 bool ReducedFraction::operator<=(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           <= fractionPart(v, val.numerator_, val.denominator_);
+    return compare(*this, val) <= 0;
 }
 
 bool ReducedFraction::operator>(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           > fractionPart(v, val.numerator_, val.denominator_);
+    return compare(*this, val) > 0;
 }
 
 bool ReducedFraction::operator>=(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           >= fractionPart(v, val.numerator_, val.denominator_);
+    return compare(*this, val) >= 0;
 }
 
 bool ReducedFraction::operator==(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           == fractionPart(v, val.numerator_, val.denominator_);
+    return compare(*this, val) == 0;
 }
 
 bool ReducedFraction::operator!=(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           != fractionPart(v, val.numerator_, val.denominator_);
+    return compare(*this, val) != 0;
 }
 
 //-------------------------------------------------------------------------
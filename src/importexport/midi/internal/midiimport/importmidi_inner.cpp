@@ -22,6 +22,7 @@
 #include "importmidi_inner.h"
 
 #include <QTextCodec>
+#include <QtConcurrent>
 
 #include "importmidi_operations.h"
 #include "importmidi_chord.h"
@@ -298,4 +299,21 @@ double durationCount(const QList<std::pair<ReducedFraction, TDuration> >& durati
     return count;
 }
 } // namespace MidiDuration
+
+namespace MidiTracks {
+void processConcurrently(std::multimap<int, MTrack>& tracks, const std::function<void(MTrack&)>& process)
+{
+    std::vector<MTrack*> trackPtrs;
+    trackPtrs.reserve(tracks.size());
+    for (auto& track: tracks) {
+        trackPtrs.push_back(&track.second);
+    }
+
+    auto& opers = midiImportOperations;
+    QtConcurrent::blockingMap(trackPtrs, [&opers, &process](MTrack* mtrack) {
+        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack->indexOfOperation };
+        process(*mtrack);
+    });
+}
+} // namespace MidiTracks
 } // namespace Ms
@@ -30,6 +30,7 @@
 #include <vector>
 #include <cstddef>
 #include <utility>
+#include <functional>
 
 // ---------------------------------------------------------------------------------------
 // These inner classes definitions are used in cpp files only
@@ -156,6 +157,13 @@ ReducedFraction findBarStart(const ReducedFraction& time, const TimeSigMap* sigm
 namespace MidiDuration {
 double durationCount(const QList<std::pair<ReducedFraction, TDuration> >& durations);
 } // namespace MidiDuration
+
+namespace MidiTracks {
+// process the tracks concurrently on the global thread pool;
+// 'process' may modify only the track it is given,
+// current track of MidiImportOperations is set for it (per thread)
+void processConcurrently(std::multimap<int, MTrack>& tracks, const std::function<void(MTrack&)>& process);
+} // namespace MidiTracks
 } // namespace Ms
 
 #endif // IMPORTMIDI_INNER_H
@@ -23,6 +23,8 @@
 
 #include <QSet>
 
+#include <atomic>
+
 #include "importmidi_tuplet.h"
 #include "importmidi_inner.h"
 #include "importmidi_chord.h"
@@ -1062,23 +1064,18 @@ void sortVoices(
 
 bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
 {
-    auto& opers = midiImportOperations;
-    bool changed = false;
+    const auto& opers = midiImportOperations;
+    std::atomic<bool> changed { false };
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
+    MidiTracks::processConcurrently(tracks, [&opers, &changed, sigmap](MTrack& mtrack) {
         if (mtrack.mtrack->drumTrack()) {
-            continue;
+            return;
         }
-        auto& chords = track.second.chords;
-        if (chords.empty()) {
-            continue;
+        if (mtrack.chords.empty()) {
+            return;
         }
         const int userVoiceCount = toIntVoiceCount(
             opers.data()->trackOpers.maxVoiceCount.value(mtrack.indexOfOperation));
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 
         if (userVoiceCount > 1 && userVoiceCount <= voiceLimit()) {
 #ifdef QT_DEBUG
@@ -1113,7 +1110,7 @@ bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap
                                                     "after voice sort");
 #endif
         }
-    }
+    });
 
     return changed;
 }
@@ -0,0 +1,329 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "libmscore/mscore.h"
+
+#include "importexport/midi/internal/midiimport/importmidi_fraction.h"
+
+using namespace Ms;
+
+//---------------------------------------------------------
+//   Reference implementation: exact values with positive
+//   denominators, and the plain gcd based arithmetic
+//   ReducedFraction used before the fast paths
+//---------------------------------------------------------
+
+namespace {
+struct RefValue {
+    int_least64_t n = 0;
+    int_least64_t d = 1;
+};
+
+RefValue refValue(const ReducedFraction& f)
+{
+    RefValue v { f.numerator(), f.denominator() };
+    if (v.d < 0) {
+        v.n = -v.n;
+        v.d = -v.d;
+    }
+    return v;
+}
+
+int refCompare(const ReducedFraction& f1, const ReducedFraction& f2)
+{
+    const RefValue v1 = refValue(f1);
+    const RefValue v2 = refValue(f2);
+    const int_least64_t l = v1.n * v2.d;
+    const int_least64_t r = v2.n * v1.d;
+    return (l < r) ? -1 : ((l > r) ? 1 : 0);
+}
+
+int refGcd(int a, int b)
+{
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a >= 0 ? a : -a;
+}
+
+int refLcm(int a, int b)
+{
+    const int g = refGcd(a, b);
+    const int l = (a / g) * b;
+    return l >= 0 ? l : -l;
+}
+
+ReducedFraction refReduce(const ReducedFraction& f)
+{
+    if (f.numerator() == 0) {
+        return ReducedFraction(0, 1);
+    }
+    const int g = refGcd(f.numerator(), f.denominator());
+    return ReducedFraction(f.numerator() / g, f.denominator() / g);
+}
+
+//! NOTE Only the left operand is reduced before the addition, as ReducedFraction does
+ReducedFraction refPreventOverflow(const ReducedFraction& f)
+{
+    static const int reduceLimit = 10000;
+    if (f.numerator() >= reduceLimit || f.denominator() >= reduceLimit) {
+        return refReduce(f);
+    }
+    return f;
+}
+
+ReducedFraction refAdd(const ReducedFraction& a, const ReducedFraction& b, int sign)
+{
+    const ReducedFraction l = refPreventOverflow(a);
+    const int lcm = refLcm(l.denominator(), b.denominator());
+    const int n = l.numerator() * (lcm / l.denominator()) + sign * b.numerator() * (lcm / b.denominator());
+    return ReducedFraction(n, lcm);
+}
+
+QString toString(const ReducedFraction& f)
+{
+    return QString("%1/%2").arg(f.numerator()).arg(f.denominator());
+}
+
+//! NOTE The denominators of the ticks, including the ones that divide each other, the negative ones and random ones
+std::vector<ReducedFraction> randomFractions(size_t count)
+{
+    static const std::vector<int> denominators = { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 480, 1920,
+                                                   -1, -2, -3, -4, -8, -480 };
+
+    std::mt19937 gen(20211019);
+    std::uniform_int_distribution<int> numerator(-2000, 2000);
+    std::uniform_int_distribution<int> denominatorIndex(0, static_cast<int>(denominators.size()));
+    std::uniform_int_distribution<int> randomDenominator(-5000, 5000);
+
+    std::vector<ReducedFraction> fractions;
+    fractions.reserve(count);
+
+    while (fractions.size() < count) {
+        size_t index = static_cast<size_t>(denominatorIndex(gen));
+        int denominator = index < denominators.size() ? denominators[index] : randomDenominator(gen);
+        if (denominator == 0) {
+            continue;
+        }
+        fractions.emplace_back(numerator(gen), denominator);
+    }
+
+    return fractions;
+}
+}
+
+//---------------------------------------------------------
+//   TestImportMidiFraction
+//---------------------------------------------------------
+
+class TestImportMidiFraction : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void compareEquivalence();
+    void negativeDenominators();
+    void addSubtractEquivalence();
+    void dividingDenominators();
+    void fromTicks();
+    void nearIntLimits();
+};
+
+//---------------------------------------------------------
+//   compareEquivalence
+//    all the comparisons give the same results as the exact ones
+//---------------------------------------------------------
+
+void TestImportMidiFraction::compareEquivalence()
+{
+    const std::vector<ReducedFraction> fractions = randomFractions(400);
+
+    for (const ReducedFraction& a : fractions) {
+        for (const ReducedFraction& b : fractions) {
+            const int ref = refCompare(a, b);
+            const QString msg = toString(a) + " vs " + toString(b);
+
+            QVERIFY2((a < b) == (ref < 0), qPrintable(msg));
+            QVERIFY2((a <= b) == (ref <= 0), qPrintable(msg));
+            QVERIFY2((a > b) == (ref > 0), qPrintable(msg));
+            QVERIFY2((a >= b) == (ref >= 0), qPrintable(msg));
+            QVERIFY2((a == b) == (ref == 0), qPrintable(msg));
+            QVERIFY2((a != b) == (ref != 0), qPrintable(msg));
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   negativeDenominators
+//    the order is reversed by exactly one negative denominator
+//---------------------------------------------------------
+
+void TestImportMidiFraction::negativeDenominators()
+{
+    QVERIFY(ReducedFraction(1, -2) < ReducedFraction(1, 4));
+    QVERIFY(ReducedFraction(1, 4) > ReducedFraction(1, -2));
+    QVERIFY(ReducedFraction(-1, -2) > ReducedFraction(1, 4));
+    QVERIFY(ReducedFraction(1, -2) == ReducedFraction(-1, 2));
+    QVERIFY(ReducedFraction(1, -2) == ReducedFraction(-2, 4));
+    QVERIFY(ReducedFraction(-3, -4) == ReducedFraction(3, 4));
+    QVERIFY(ReducedFraction(1, -3) > ReducedFraction(1, -2));
+    QVERIFY(ReducedFraction(0, -5) == ReducedFraction(0, 1));
+    QVERIFY(!(ReducedFraction(0, -5) < ReducedFraction(0, 3)));
+
+    QVERIFY((ReducedFraction(1, -2) + ReducedFraction(1, 4)) == ReducedFraction(-1, 4));
+    QVERIFY((ReducedFraction(1, 4) - ReducedFraction(1, -2)) == ReducedFraction(3, 4));
+}
+
+//---------------------------------------------------------
+//   addSubtractEquivalence
+//    the sums and differences have exactly the same numerator
+//    and denominator as with the plain gcd arithmetic
+//---------------------------------------------------------
+
+void TestImportMidiFraction::addSubtractEquivalence()
+{
+    const std::vector<ReducedFraction> fractions = randomFractions(200);
+
+    for (const ReducedFraction& a : fractions) {
+        for (const ReducedFraction& b : fractions) {
+            const ReducedFraction sum = a + b;
+            const ReducedFraction refSum = refAdd(a, b, 1);
+            QVERIFY2(sum.isIdenticalTo(refSum), qPrintable(toString(a) + " + " + toString(b) + " = " + toString(sum)
+                                                           + ", expected " + toString(refSum)));
+
+            const ReducedFraction diff = a - b;
+            const ReducedFraction refDiff = refAdd(a, b, -1);
+            QVERIFY2(diff.isIdenticalTo(refDiff), qPrintable(toString(a) + " - " + toString(b) + " = " + toString(diff)
+                                                             + ", expected " + toString(refDiff)));
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   dividingDenominators
+//    the lcm fast path, where one denominator divides the other
+//---------------------------------------------------------
+
+void TestImportMidiFraction::dividingDenominators()
+{
+    const std::vector<int> denominators = { 1, 2, 4, 8, 16, 3, 6, 12, 24, 480, 1920, -1, -2, -4, -480 };
+
+    for (int d1 : denominators) {
+        for (int d2 : denominators) {
+            if (d1 % d2 != 0 && d2 % d1 != 0) {
+                continue;
+            }
+
+            for (int n1 = -5; n1 <= 5; ++n1) {
+                for (int n2 = -5; n2 <= 5; ++n2) {
+                    const ReducedFraction a(n1, d1);
+                    const ReducedFraction b(n2, d2);
+                    const QString msg = toString(a) + ", " + toString(b);
+
+                    QVERIFY2((a + b).isIdenticalTo(refAdd(a, b, 1)), qPrintable(msg));
+                    QVERIFY2((a - b).isIdenticalTo(refAdd(a, b, -1)), qPrintable(msg));
+                    QVERIFY2((a + b).denominator() == std::max(std::abs(d1), std::abs(d2)), qPrintable(msg));
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   fromTicks
+//    the whole measure fast path gives the same as the reduction
+//---------------------------------------------------------
+
+void TestImportMidiFraction::fromTicks()
+{
+    const int wholeTicks = MScore::division * 4;
+
+    for (int ticks = -3 * wholeTicks; ticks <= 3 * wholeTicks; ++ticks) {
+        const ReducedFraction f = ReducedFraction::fromTicks(ticks);
+        const ReducedFraction ref = refReduce(ReducedFraction(ticks, wholeTicks));
+
+        QVERIFY2(f.isIdenticalTo(ref), qPrintable(QString::number(ticks) + ": " + toString(f) + ", expected " + toString(ref)));
+
+        // ticks() rounds the negative values towards zero, they are never converted back
+        if (ticks >= 0) {
+            QCOMPARE(f.ticks(), ticks);
+        }
+    }
+
+    QVERIFY(ReducedFraction::fromTicks(8 * wholeTicks).isIdenticalTo(ReducedFraction(8, 1)));
+    QVERIFY(ReducedFraction::fromTicks(-wholeTicks).isIdenticalTo(ReducedFraction(-1, 1)));
+    QVERIFY(ReducedFraction::fromTicks(0).isIdenticalTo(ReducedFraction(0, 1)));
+}
+
+//---------------------------------------------------------
+//   nearIntLimits
+//    the cross products of the comparisons do not fit into int
+//---------------------------------------------------------
+
+void TestImportMidiFraction::nearIntLimits()
+{
+    const int max = std::numeric_limits<int>::max();
+    const int min = std::numeric_limits<int>::min();
+
+    QVERIFY(ReducedFraction(max, max - 1) < ReducedFraction(max - 1, max - 2));
+    QVERIFY(ReducedFraction(max - 1, max - 2) > ReducedFraction(max, max - 1));
+    QVERIFY(ReducedFraction(max, max) == ReducedFraction(1, 1));
+    QVERIFY(ReducedFraction(max - 1, max) < ReducedFraction(1, 1));
+    QVERIFY(ReducedFraction(1, max) > ReducedFraction(1, -max));
+    QVERIFY(ReducedFraction(max, -1) == ReducedFraction(-max, 1));
+    QVERIFY(ReducedFraction(min, 1) < ReducedFraction(max, 1));
+    QVERIFY(ReducedFraction(min, max) < ReducedFraction(-1, 1));
+    QVERIFY(ReducedFraction(min, min) == ReducedFraction(1, 1));
+    QVERIFY(ReducedFraction(1, min) < ReducedFraction(0, 1));
+    QVERIFY(ReducedFraction(max / 2, max) < ReducedFraction(1, 2));
+    QVERIFY(ReducedFraction(max / 2 + 1, max) > ReducedFraction(1, 2));
+
+    const std::vector<ReducedFraction> fractions = {
+        ReducedFraction(max, 1), ReducedFraction(max, max - 1), ReducedFraction(max - 1, max), ReducedFraction(min, 1),
+        ReducedFraction(min + 1, max), ReducedFraction(1, max), ReducedFraction(1, -max), ReducedFraction(-1, min + 1),
+        ReducedFraction(max / 2, max), ReducedFraction(0, max), ReducedFraction(1, 1), ReducedFraction(-1, 1)
+    };
+
+    for (const ReducedFraction& a : fractions) {
+        for (const ReducedFraction& b : fractions) {
+            const int ref = refCompare(a, b);
+            const QString msg = toString(a) + " vs " + toString(b);
+
+            QVERIFY2((a < b) == (ref < 0), qPrintable(msg));
+            QVERIFY2((a == b) == (ref == 0), qPrintable(msg));
+            QVERIFY2((a > b) == (ref > 0), qPrintable(msg));
+        }
+    }
+}
+
+QTEST_MAIN(TestImportMidiFraction)
+#include "tst_importmidi_fraction.moc"
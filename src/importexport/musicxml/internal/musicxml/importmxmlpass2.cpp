@@ -1553,6 +1553,8 @@ Score::FileError MusicXMLParserPass2::parse(QIODevice* device)
 
 Score::FileError MusicXMLParserPass2::parse()
 {
+    initMeasureMap();
+
     bool found = false;
     while (_e.readNextStartElement()) {
         if (_e.name() == "score-partwise") {
@@ -1758,21 +1760,36 @@ void MusicXMLParserPass2::part()
 }
 
 //---------------------------------------------------------
-//   findMeasure
+//   initMeasureMap
 //---------------------------------------------------------
 
 /**
- In Score \a score find the measure starting at \a tick.
+ Index the measures created in pass 1 by start tick.
+ Pass 2 looks up the measure for every <measure> of every part,
+ a linear search through the score made that quadratic in the
+ number of measures.
  */
 
-static Measure* findMeasure(Score* score, const Fraction& tick)
+void MusicXMLParserPass2::initMeasureMap()
 {
-    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
-        if (m->tick() == tick) {
-            return m;
-        }
+    _measures.clear();
+    for (Measure* m = _score->firstMeasure(); m; m = m->nextMeasure()) {
+        _measures.emplace(m->tick(), m);         // keeps the first measure at a tick
     }
-    return 0;
+}
+
+//---------------------------------------------------------
+//   findMeasure
+//---------------------------------------------------------
+
+/**
+ Find the measure starting at \a tick.
+ */
+
+Measure* MusicXMLParserPass2::findMeasure(const Fraction& tick) const
+{
+    auto it = _measures.find(tick);
+    return it != _measures.end() ? it->second : nullptr;
 }
 
 //---------------------------------------------------------
@@ -1992,7 +2009,7 @@ void MusicXMLParserPass2::measure(const QString& partId, const Fraction time)
     QString number = _e.attributes().value("number").toString();
     //qDebug("measure %s start", qPrintable(number));
 
-    Measure* measure = findMeasure(_score, time);
+    Measure* measure = findMeasure(time);
     if (!measure) {
         _logger->logError(QString("measure at tick %1 not found!").arg(time.ticks()), &_e);
         skipLogCurrElem();
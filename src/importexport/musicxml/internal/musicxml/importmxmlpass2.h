@@ -24,6 +24,7 @@
 #define __IMPORTMXMLPASS2_H__
 
 #include <array>
+#include <map>
 
 #include "libmscore/masterscore.h"
 #include "libmscore/tuplet.h"
@@ -262,6 +263,8 @@ public:
 private:
     void addError(const QString& error);      ///< Add an error to be shown in the GUI
     void initPartState(const QString& partId);
+    void initMeasureMap();
+    Measure* findMeasure(const Fraction& tick) const;
     SpannerSet findIncompleteSpannersAtPartEnd();
     Score::FileError parse();
     void scorePartwise();
@@ -312,6 +315,7 @@ private:
     MusicXMLParserPass1& _pass1;          // the pass1 results
     MxmlLogger* _logger;                  ///< Error logger
     QString _errors;                      ///< Errors to present to the user
+    std::map<Fraction, Measure*> _measures;  ///< Measures created in pass 1, by start tick
 
     // part specific data (TODO: move to part-specific class)
 
@@ -32,6 +32,20 @@
 #include "thirdparty/qzip/qzipreader_p.h"
 #include "importmxml.h"
 
+#include "modularity/ioc.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
+
+static std::shared_ptr<mu::iex::musicxml::IMusicXmlConfiguration> configuration()
+{
+    return mu::modularity::ioc()->resolve<mu::iex::musicxml::IMusicXmlConfiguration>("iex_musicxml");
+}
+
+static bool musicxmlImportValidation()
+{
+    auto conf = configuration();
+    return conf ? conf->musicxmlImportValidation() : true;
+}
+
 namespace Ms {
 //---------------------------------------------------------
 //   tupletAssert -- check assertions for tuplet handling
@@ -102,6 +116,30 @@ static bool initMusicXmlSchema(QXmlSchema& schema)
     return true;
 }
 
+//---------------------------------------------------------
+//   musicXmlSchema
+//    return nullptr on error
+//---------------------------------------------------------
+
+/**
+ Return the compiled MusicXML schema.
+ Compiling the schema is expensive, so it is done only once
+ and the result is shared by all subsequent imports.
+ */
+
+static const QXmlSchema* musicXmlSchema()
+{
+    static QXmlSchema schema;
+    static const bool schemaValid = initMusicXmlSchema(schema);
+
+    if (!schemaValid) {
+        MScore::lastError = QObject::tr("Internal error: MusicXML schema is invalid\n");
+        return nullptr;
+    }
+
+    return &schema;
+}
+
 //---------------------------------------------------------
 //   musicXMLValidationErrorDialog
 //---------------------------------------------------------
@@ -193,15 +231,15 @@ static Score::FileError doValidate(const QString& name, QIODevice* dev)
     //QElapsedTimer t;
     //t.start();
 
-    // initialize the schema
-    ValidatorMessageHandler messageHandler;
-    QXmlSchema schema;
-    schema.setMessageHandler(&messageHandler);
-    if (!initMusicXmlSchema(schema)) {
+    // get the (cached) schema
+    const QXmlSchema* schema = musicXmlSchema();
+    if (!schema) {
         return Score::FileError::FILE_BAD_FORMAT;      // appropriate error message has been printed by initMusicXmlSchema
     }
     // validate the data
-    QXmlSchemaValidator validator(schema);
+    ValidatorMessageHandler messageHandler;
+    QXmlSchemaValidator validator(*schema);
+    validator.setMessageHandler(&messageHandler);
     bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
     //qDebug("Validation time elapsed: %d ms", t.elapsed());
 
@@ -233,11 +271,13 @@ static Score::FileError doValidateAndImport(Score* score, const QString& name, Q
     // verify tuplet TDuration::DurationType dependencies
     tupletAssert();
 
-    // validate the file
+    // validate the file, unless disabled for trusted sources (e.g. in batch conversion)
     Score::FileError res;
-    res = doValidate(name, dev);
-    if (res != Score::FileError::FILE_NO_ERROR) {
-        return res;
+    if (musicxmlImportValidation()) {
+        res = doValidate(name, dev);
+        if (res != Score::FileError::FILE_NO_ERROR) {
+            return res;
+        }
     }
 
     // actually do the import
@@ -22,6 +22,8 @@
 #ifndef MU_IMPORTEXPORT_MUSICXMLCONFIGURATION_H
 #define MU_IMPORTEXPORT_MUSICXMLCONFIGURATION_H
 
+#include <optional>
+
 #include "../imusicxmlconfiguration.h"
 
 namespace mu::iex::musicxml {
@@ -36,6 +38,9 @@ public:
     bool musicxmlImportLayout() const override;
     void setMusicxmlImportLayout(bool value) override;
 
+    bool musicxmlImportValidation() const override;
+    void setMusicxmlImportValidation(bool value, bool persistent = true) override;
+
     bool musicxmlExportLayout() const override;
     void setMusicxmlExportLayout(bool value) override;
 
@@ -53,6 +58,9 @@ public:
 
     io::path styleFileImportPath() const override;
     void setStyleFileImportPath(const io::path& path) override;
+
+private:
+    std::optional<bool> m_sessionImportValidation;
 };
 }
 
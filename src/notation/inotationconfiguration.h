@@ -76,6 +76,9 @@ public:
     virtual int selectionProximity() const = 0;
     virtual void setSelectionProximity(int proxymity) = 0;
 
+    virtual double lowDetailSpatiumThreshold() const = 0;
+    virtual void setLowDetailSpatiumThreshold(double pixels) = 0;
+
     virtual ZoomType defaultZoomType() const = 0;
     virtual void setDefaultZoomType(ZoomType zoomType) = 0;
 
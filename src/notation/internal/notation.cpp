@@ -189,6 +189,11 @@ void Notation::paint(mu::draw::Painter* painter, const RectF& frameRect)
 
 void Notation::paintPages(draw::Painter* painter, const RectF& frameRect, const QList<Ms::Page*>& pages, bool paintBorders) const
 {
+    //! NOTE Below this size of a spatium on the device the details of the score are not legible,
+    //! so a simplified version is painted (zoomed out canvas, navigator)
+    qreal spatiumOnDevice = score()->spatium() * std::abs(painter->worldTransform().m11());
+    bool lowDetail = !score()->printing() && spatiumOnDevice < configuration()->lowDetailSpatiumThreshold();
+
     for (Ms::Page* page : pages) {
         RectF pageRect(page->abbox().translated(page->pos()));
 
@@ -209,7 +214,7 @@ void Notation::paintPages(draw::Painter* painter, const RectF& frameRect, const
         paintForeground(painter, page->bbox());
         painter->translate(-pagePosition);
 
-        engraving::Paint::paintPage(*painter, page, frameRect.translated(-page->pos()));
+        engraving::Paint::paintPage(*painter, page, frameRect.translated(-page->pos()), lowDetail);
     }
 }
 
@@ -55,6 +55,7 @@ static const Settings::Key FOREGROUND_WALLPAPER_PATH(module_name, "ui/canvas/for
 static const Settings::Key FOREGROUND_USE_COLOR(module_name, "ui/canvas/foreground/useColor");
 
 static const Settings::Key SELECTION_PROXIMITY(module_name, "ui/canvas/misc/selectionProximity");
+static const Settings::Key LOW_DETAIL_SPATIUM_THRESHOLD(module_name, "ui/canvas/misc/lowDetailSpatiumThreshold");
 
 static const Settings::Key DEFAULT_ZOOM_TYPE(module_name, "ui/canvas/zoomDefaultType");
 static const Settings::Key DEFAULT_ZOOM(module_name, "ui/canvas/zoomDefaultLevel");
@@ -159,6 +160,7 @@ void NotationConfiguration::init()
     fileSystem()->makePath(userStylesPath());
 
     settings()->setDefaultValue(SELECTION_PROXIMITY, Val(6));
+    settings()->setDefaultValue(LOW_DETAIL_SPATIUM_THRESHOLD, Val(2.0));
     settings()->setDefaultValue(IS_MIDI_INPUT_ENABLED, Val(false));
     settings()->setDefaultValue(IS_AUTOMATICALLY_PAN_ENABLED, Val(true));
     settings()->setDefaultValue(IS_PLAY_REPEATS_ENABLED, Val(false));
@@ -372,6 +374,16 @@ void NotationConfiguration::setSelectionProximity(int proxymity)
     settings()->setSharedValue(SELECTION_PROXIMITY, Val(proxymity));
 }
 
+double NotationConfiguration::lowDetailSpatiumThreshold() const
+{
+    return settings()->value(LOW_DETAIL_SPATIUM_THRESHOLD).toDouble();
+}
+
+void NotationConfiguration::setLowDetailSpatiumThreshold(double pixels)
+{
+    settings()->setSharedValue(LOW_DETAIL_SPATIUM_THRESHOLD, Val(pixels));
+}
+
 ZoomType NotationConfiguration::defaultZoomType() const
 {
     return static_cast<ZoomType>(settings()->value(DEFAULT_ZOOM_TYPE).toInt());
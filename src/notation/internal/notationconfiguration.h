@@ -81,6 +81,9 @@ public:
     int selectionProximity() const override;
     void setSelectionProximity(int proxymity) override;
 
+    double lowDetailSpatiumThreshold() const override;
+    void setLowDetailSpatiumThreshold(double pixels) override;
+
     ZoomType defaultZoomType() const override;
     void setDefaultZoomType(ZoomType zoomType) override;
 
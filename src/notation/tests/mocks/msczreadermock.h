@@ -31,6 +31,8 @@ class MsczReaderMock : public project::IMscMetaReader
 {
 public:
     MOCK_METHOD(RetVal<project::ProjectMeta>, readMeta, (const io::path& filePath), (const, override));
+    MOCK_METHOD(bool, isMetaIndexed, (const io::path& filePath), (const, override));
+    MOCK_METHOD(void, indexMeta, (const io::path& filePath), (const, override));
 };
 }
 
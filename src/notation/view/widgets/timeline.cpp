@@ -756,6 +756,7 @@ Timeline::Timeline(QSplitter* splitter)
 
     connect(verticalScrollBar(), &QScrollBar::valueChanged, _rowNames->verticalScrollBar(), &QScrollBar::setValue);
     connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &Timeline::handleScroll);
+    connect(horizontalScrollBar(), &QScrollBar::valueChanged, this, &Timeline::updateGridItems);
     connect(_rowNames, &TRowLabels::swapMeta, this, &Timeline::swapMeta);
     connect(this, &Timeline::moved, _rowNames, &TRowLabels::mouseOver);
 
@@ -974,16 +975,7 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         endMeasure = globalCols;
     } else {
         if (rebuildPartial) {
-            const QRectF replacedRect
-                = getMeasureRect(startMeasure, 0, numMetas) | getMeasureRect(endMeasure - 1, globalRows - 1, numMetas);
-            const QList<QGraphicsItem*> replacedItems = scene()->items(replacedRect, Qt::ContainsItemShape);
-            for (QGraphicsItem* item : replacedItems) {
-                if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_MEASURE) {
-                    continue;
-                }
-                scene()->removeItem(item);
-                delete item;
-            }
+            removeGridItems(QRect(startMeasure, 0, endMeasure - startMeasure, globalRows) & _gridItemCells, numMetas);
         }
 
         // Meta rows are still rebuilt from scratch, remove old meta rows manually
@@ -999,6 +991,9 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
 
     _metaRows.clear();
 
+    gridRows = globalRows;
+    gridCols = globalCols;
+
     if (globalRows == 0 || globalCols == 0) {
         return;
     }
@@ -1008,47 +1003,15 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
     setMinimumWidth(_gridWidth * 3);
     _globalZValue = 1;
 
-    // Draw grid
-    Measure* currMeasure = score()->firstMeasure();
-    for (int i = 0; i < startMeasure; ++i) {
-        currMeasure = currMeasure->nextMeasure();
-    }
-
-    QList<Part*> partList = getParts();
-
-    for (int col = startMeasure; col < endMeasure; col++) {
-        for (int row = 0; row < globalRows; row++) {
-            QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
-            graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
-
-            setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
-
-            QString translateMeasure = tr("Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
-                }
-            }
-
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
-            graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
-            graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            graphicsRectItem->setZValue(-3);
-            scene()->addItem(graphicsRectItem);
-        }
+    // Only the cells around the viewport get scene items, the rest are created on scroll
+    setSceneRect(0, 0, getWidth(), getHeight());
 
-        currMeasure = currMeasure->nextMeasure();
+    if (rebuildAll) {
+        _gridItemCells = visibleGridCells(true);
+        createGridItems(_gridItemCells, numMetas);
+    } else if (rebuildPartial) {
+        createGridItems(QRect(startMeasure, 0, endMeasure - startMeasure, globalRows) & _gridItemCells, numMetas);
     }
-    setSceneRect(0, 0, getWidth(), getHeight());
 
     // Draw meta rows and separator
     QGraphicsLineItem* graphicsLineItemSeparator = new QGraphicsLineItem(0,
@@ -1160,9 +1123,148 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         xPos += _gridWidth;
         std::get<4>(_repeatInfo) = false;
     }
+}
 
-    gridRows = globalRows;
-    gridCols = globalCols;
+//---------------------------------------------------------
+//   Timeline::visibleGridCells
+//---------------------------------------------------------
+
+QRect Timeline::visibleGridCells(bool withMargin) const
+{
+    const QRectF visibleRect = mapToScene(viewport()->rect()).boundingRect();
+    const int numMetas = int(nmetas());
+
+    int firstCol = int(visibleRect.left()) / _gridWidth;
+    int endCol = int(visibleRect.right()) / _gridWidth + 1;
+    int firstRow = int(visibleRect.top() - 3) / _gridHeight - numMetas;
+    int endRow = int(visibleRect.bottom() - 3) / _gridHeight - numMetas + 1;
+
+    if (withMargin) {
+        // Keep a viewport worth of cells on every side so that scrolling rarely needs new items
+        const int marginCols = endCol - firstCol;
+        const int marginRows = endRow - firstRow;
+        firstCol -= marginCols;
+        endCol += marginCols;
+        firstRow -= marginRows;
+        endRow += marginRows;
+    }
+
+    firstCol = std::max(firstCol, 0);
+    endCol = std::min(endCol, gridCols);
+    firstRow = std::max(firstRow, 0);
+    endRow = std::min(endRow, gridRows);
+
+    if (firstCol >= endCol || firstRow >= endRow) {
+        return QRect();
+    }
+
+    return QRect(firstCol, firstRow, endCol - firstCol, endRow - firstRow);
+}
+
+//---------------------------------------------------------
+//   Timeline::createGridItems
+//---------------------------------------------------------
+
+void Timeline::createGridItems(const QRect& cells, int numMetas)
+{
+    if (cells.isEmpty()) {
+        return;
+    }
+
+    Measure* currMeasure = score()->firstMeasure();
+    for (int i = 0; i < cells.left() && currMeasure; ++i) {
+        currMeasure = currMeasure->nextMeasure();
+    }
+
+    QList<Part*> partList = getParts();
+
+    // Everything that doesn't depend on the measure is computed once per row,
+    // parsing the part names as HTML for every cell dominated the rebuild time
+    const QString translateMeasure = tr("Measure");
+    const QString measurePrefix = translateMeasure.isEmpty() ? QString() : QString(translateMeasure[0]) + QString(" ");
+    const QPen cellPen(activeTheme().backgroundColor);
+
+    std::vector<QString> rowToolTipSuffixes(cells.bottom() + 1, QString(", "));
+    for (int row = cells.top(); row <= cells.bottom() && row < partList.size(); row++) {
+        QTextDocument doc;
+        doc.setHtml(partList.at(row)->longName());
+        QString partName = doc.toPlainText();
+        if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+            doc.setHtml(partList.at(row)->partName());
+            partName = doc.toPlainText();
+        }
+        if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+            partName = partList.at(row)->instrumentName();
+        }
+        rowToolTipSuffixes[row] = QString(", ") + partName;
+    }
+
+    for (int col = cells.left(); col <= cells.right() && currMeasure; col++) {
+        const QString measureToolTip = measurePrefix + QString::number(currMeasure->no() + 1);
+
+        for (int row = cells.top(); row <= cells.bottom(); row++) {
+            QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
+            graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
+
+            setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
+
+            graphicsRectItem->setToolTip(measureToolTip + rowToolTipSuffixes[row]);
+            graphicsRectItem->setPen(cellPen);
+            graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
+            graphicsRectItem->setZValue(-3);
+            scene()->addItem(graphicsRectItem);
+        }
+
+        currMeasure = currMeasure->nextMeasure();
+    }
+}
+
+//---------------------------------------------------------
+//   Timeline::removeGridItems
+//---------------------------------------------------------
+
+void Timeline::removeGridItems(const QRect& cells, int numMetas)
+{
+    if (cells.isEmpty()) {
+        return;
+    }
+
+    const QRectF removedRect = getMeasureRect(cells.left(), cells.top(), numMetas)
+                               | getMeasureRect(cells.right(), cells.bottom(), numMetas);
+    const QList<QGraphicsItem*> removedItems = scene()->items(removedRect, Qt::ContainsItemShape);
+    for (QGraphicsItem* item : removedItems) {
+        if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_MEASURE) {
+            continue;
+        }
+        scene()->removeItem(item);
+        delete item;
+    }
+}
+
+//---------------------------------------------------------
+//   Timeline::updateGridItems
+//---------------------------------------------------------
+
+void Timeline::updateGridItems()
+{
+    if (!score() || gridRows == 0 || gridCols == 0) {
+        return;
+    }
+
+    const QRect visibleCells = visibleGridCells(false);
+    if (visibleCells.isEmpty() || _gridItemCells.contains(visibleCells)) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    const int numMetas = int(nmetas());
+    removeGridItems(_gridItemCells, numMetas);
+    _gridItemCells = visibleGridCells(true);
+    createGridItems(_gridItemCells, numMetas);
+
+    // Color the new cells and rebuild the selection outline from them
+    drawSelection();
 }
 
 //---------------------------------------------------------
@@ -1838,6 +1940,7 @@ QList<Part*> Timeline::getParts()
 void Timeline::clearScene()
 {
     scene()->clear();
+    _gridItemCells = QRect();
 
     // clear pointers to scene items, they have been deleted by clear()
     nonVisiblePathItem = nullptr;
@@ -2469,6 +2572,16 @@ void Timeline::wheelEvent(QWheelEvent* event)
     }
 }
 
+//---------------------------------------------------------
+//   resizeEvent
+//---------------------------------------------------------
+
+void Timeline::resizeEvent(QResizeEvent* event)
+{
+    QGraphicsView::resizeEvent(event);
+    updateGridItems();
+}
+
 //---------------------------------------------------------
 //   showEvent
 //---------------------------------------------------------
@@ -2543,7 +2656,11 @@ void Timeline::updateGridFromCmdState()
     const bool layoutChanged = cState.layoutRange();
 
     if (!layoutChanged) {
-        updateGridView();
+        // Nothing the grid or the meta rows show has changed, only the selection may have
+        updateView();
+        drawSelection();
+        mouseOver(mapToScene(mapFromGlobal(QCursor::pos())));
+        viewport()->update();
         return;
     }
 
@@ -2831,6 +2948,7 @@ void Timeline::handleScroll(int value)
             graphicsItem->setY(qreal(scrollbarValue + rowY));
         }
     }
+    updateGridItems();
     viewport()->update();
 }
 
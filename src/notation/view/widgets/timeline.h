@@ -176,6 +176,9 @@ private:
     int gridRows = 0;
     int gridCols = 0;
 
+    // Measure cells (x) and staff rows (y) that currently have grid items in the scene
+    QRect _gridItemCells;
+
     QGraphicsPathItem* nonVisiblePathItem = nullptr;
     QGraphicsPathItem* visiblePathItem = nullptr;
     QGraphicsPathItem* selectionItem = nullptr;
@@ -215,6 +218,7 @@ private:
     void mouseMoveEvent(QMouseEvent* event) override;
     void mouseReleaseEvent(QMouseEvent*) override;
     void wheelEvent(QWheelEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
     void leaveEvent(QEvent*) override;
     void showEvent(QShowEvent*) override;
     void changeEvent(QEvent*) override;
@@ -231,6 +235,10 @@ private:
 
     void clearScene();
 
+    QRect visibleGridCells(bool withMargin) const;
+    void createGridItems(const QRect& cells, int numMetas);
+    void removeGridItems(const QRect& cells, int numMetas);
+
     void updateGrid(int startMeasure = -1, int endMeasure = -1);
 
     mu::notation::INotationInteractionPtr interaction() const;
@@ -238,6 +246,7 @@ private:
 
 private slots:
     void handleScroll(int value);
+    void updateGridItems();
 
     void changeSelection(SelState);
     void mouseOver(QPointF pos);
@@ -22,6 +22,7 @@
 #include "palettecell.h"
 
 #include "mimedatautils.h"
+#include "palettecelliconengine.h"
 
 #include "engraving/infrastructure/io/xml.h"
 #include "engraving/libmscore/actionicon.h"
@@ -142,6 +143,7 @@ void PaletteCell::retranslate()
         TextBase* orig = toTextBase(untranslatedElement.get());
         const QString& text = orig->xmlText();
         target->setXmlText(mu::qtrc("palette", text.toUtf8().constData()));
+        PaletteCellIconEngine::invalidateCell(id);
     }
 }
 
@@ -207,6 +209,7 @@ bool PaletteCell::read(XmlReader& e)
     }
 
     setElementTranslated(translateElement);
+    PaletteCellIconEngine::invalidateCell(id);
 
     return add && element;
 }
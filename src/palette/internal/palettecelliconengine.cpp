@@ -21,6 +21,13 @@
  */
 #include "palettecelliconengine.h"
 
+#include <mutex>
+#include <unordered_map>
+
+#include <QImage>
+#include <QPainter>
+#include <QTextStream>
+
 #include "engraving/infrastructure/draw/geometry.h"
 #include "engraving/infrastructure/draw/painter.h"
 #include "engraving/infrastructure/draw/pen.h"
@@ -35,6 +42,25 @@ using namespace mu::palette;
 using namespace mu::draw;
 using namespace Ms;
 
+//! NOTE The icons are painted by the QML views on the render thread, where QPixmap
+//! (and so QPixmapCache) can not be used, so the rendered cells are kept as images.
+//! The images of a cell are keyed by the cell id and dropped by invalidateCell when the cell
+//! or its element changes, the rest of the rendering state is a part of the image key
+struct CellImageCache {
+    std::mutex mutex;
+    std::unordered_map<std::string /*cellId*/, std::unordered_map<std::string /*imageKey*/, QImage> > images;
+    qint64 sizeInBytes = 0;
+};
+
+//! NOTE Palettes have hundreds of cells, so it is never hit in practice, just a guard against growing forever
+static constexpr qint64 CELL_IMAGE_CACHE_MAX_BYTES = 64 * 1024 * 1024;
+
+static CellImageCache& cellImageCache()
+{
+    static CellImageCache cache;
+    return cache;
+}
+
 PaletteCellIconEngine::PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag)
     : QIconEngine(), m_cell(cell), m_extraMag(extraMag)
 {
@@ -47,11 +73,95 @@ QIconEngine* PaletteCellIconEngine::clone() const
 
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
-    p.restore();
+    TRACEFUNC;
+
+    if (rect.isEmpty()) {
+        return;
+    }
+
+    //! NOTE Laying out and drawing the element is expensive and happens on every repaint
+    //! while scrolling, so the rendered cell is cached
+    const bool selected = mode == QIcon::Selected;
+    const bool current = state == QIcon::On;
+    const qreal dpr = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+    const std::string cellId = m_cell ? m_cell->id.toStdString() : std::string();
+    const std::string key = imageKey(rect.size(), dpr, selected, current).toStdString();
+
+    CellImageCache& cache = cellImageCache();
+    QImage image;
+
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto cellImages = cache.images.find(cellId);
+        if (cellImages != cache.images.end()) {
+            auto search = cellImages->second.find(key);
+            if (search != cellImages->second.end()) {
+                image = search->second;
+            }
+        }
+    }
+
+    if (image.isNull()) {
+        image = QImage(rect.size() * dpr, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        {
+            Painter p(&image, "palettecell");
+            p.setAntialiasing(true);
+            paintCell(p, RectF(0, 0, rect.width(), rect.height()), selected, current);
+        }
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.sizeInBytes > CELL_IMAGE_CACHE_MAX_BYTES) {
+            cache.images.clear();
+            cache.sizeInBytes = 0;
+        }
+
+        cache.images[cellId][key] = image;
+        cache.sizeInBytes += image.sizeInBytes();
+    }
+
+    qp->drawImage(rect.topLeft(), image);
+}
+
+void PaletteCellIconEngine::invalidateCell(const QString& cellId)
+{
+    CellImageCache& cache = cellImageCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    auto cellImages = cache.images.find(cellId.toStdString());
+    if (cellImages == cache.images.end()) {
+        return;
+    }
+
+    for (const auto& image : cellImages->second) {
+        cache.sizeInBytes -= image.second.sizeInBytes();
+    }
+
+    cache.images.erase(cellImages);
+}
+
+/// The key covers the rendering state besides the element itself (which is covered by invalidateCell),
+/// so the images of restyled cells (workspace, colour scheme, scaling) are simply no longer hit
+QString PaletteCellIconEngine::imageKey(const QSize& size, qreal dpr, bool selected, bool current) const
+{
+    QString key;
+    QTextStream stream(&key);
+
+    if (m_cell) {
+        stream << m_cell->mag << ':' << m_cell->xoffset << ':' << m_cell->yoffset << ':' << m_cell->drawStaff;
+    }
+
+    stream << ':' << m_extraMag << ':' << size.width() << 'x' << size.height() << ':' << dpr
+           << ':' << uiConfiguration()->guiScaling()
+           << ':' << configuration()->paletteSpatium()
+           << ':' << configuration()->elementsColor().name(QColor::HexArgb)
+           << ':' << configuration()->accentColor().name(QColor::HexArgb)
+           << ':' << selected << ':' << current;
+    stream.flush();
+
+    return key;
 }
 
 void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current) const
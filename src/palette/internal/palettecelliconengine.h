@@ -45,7 +45,11 @@ public:
 
     static void paintPaletteElement(void* data, Ms::EngravingItem* element);
 
+    //! NOTE Call when the cell or its element is changed
+    static void invalidateCell(const QString& cellId);
+
 private:
+    QString imageKey(const QSize& size, qreal dpr, bool selected, bool current) const;
     void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, Ms::EngravingItem* element) const;
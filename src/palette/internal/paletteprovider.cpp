@@ -33,6 +33,7 @@
 #include "libmscore/timesig.h"
 
 #include "palettecreator.h"
+#include "palettecelliconengine.h"
 #include "view/widgets/keyedit.h"
 #include "view/widgets/timedialog.h"
 
@@ -524,6 +525,7 @@ void UserPaletteController::editCellProperties(const QModelIndex& index)
         cell->drawStaff = config.drawStaff;
         cell->xoffset = config.xOffset;
         cell->yoffset = config.yOffset;
+        PaletteCellIconEngine::invalidateCell(cell->id);
         _userPalette->itemDataChanged(srcIndex);
     });
 
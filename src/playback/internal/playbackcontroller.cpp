@@ -164,6 +164,27 @@ Notification PlaybackController::currentTrackSequenceIdChanged() const
     return m_currentSequenceIdChanged;
 }
 
+TrackIdList PlaybackController::notationTrackIdList(const INotationPtr notation) const
+{
+    TrackIdList result;
+
+    if (!notation || !m_masterNotation) {
+        return result;
+    }
+
+    //! NOTE The tracks belong to the parts of the master notation, the excerpts share the ids of the parts
+    INotationPartsPtr notationParts = notation->parts();
+
+    for (const Part* part : m_masterNotation->parts()->partList()) {
+        auto search = m_trackIdMap.find(part->id());
+        if (search != m_trackIdMap.end() && notationParts->partExists(part->id())) {
+            result.push_back(search->second);
+        }
+    }
+
+    return result;
+}
+
 void PlaybackController::playElement(const notation::EngravingItem* element)
 {
     if (!configuration()->playNotesWhenEditing()) {
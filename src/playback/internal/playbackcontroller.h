@@ -71,6 +71,7 @@ public:
 
     audio::TrackSequenceId currentTrackSequenceId() const override;
     async::Notification currentTrackSequenceIdChanged() const override;
+    audio::TrackIdList notationTrackIdList(const notation::INotationPtr notation) const override;
 
     void playElement(const notation::EngravingItem* element) override;
 
@@ -26,6 +26,7 @@
 #include "async/notification.h"
 #include "async/channel.h"
 
+#include "notation/inotation.h"
 #include "notation/notationtypes.h"
 #include "audio/audiotypes.h"
 #include "actions/actiontypes.h"
@@ -53,6 +54,7 @@ public:
     virtual float playbackPositionInSeconds() const = 0;
     virtual audio::TrackSequenceId currentTrackSequenceId() const = 0;
     virtual async::Notification currentTrackSequenceIdChanged() const = 0;
+    virtual audio::TrackIdList notationTrackIdList(const notation::INotationPtr notation) const = 0;
 
     virtual void playElement(const notation::EngravingItem* element) = 0;
 
@@ -38,6 +38,12 @@ public:
     virtual ~IMscMetaReader() = default;
 
     virtual RetVal<ProjectMeta> readMeta(const io::path& filePath) const = 0;
+
+    //! NOTE Whether readMeta for this file is served from the meta index, without opening the file
+    virtual bool isMetaIndexed(const io::path& filePath) const = 0;
+
+    //! NOTE Reads the file into the meta index, can be called from any thread
+    virtual void indexMeta(const io::path& filePath) const = 0;
 };
 }
 
@@ -26,6 +26,7 @@
 
 #include "io/path.h"
 #include "ret.h"
+#include "async/channel.h"
 
 #include "projecttypes.h"
 #include "notation/imasternotation.h"
@@ -48,6 +49,13 @@ public:
     virtual Ret save(const io::path& path = io::path(), SaveMode saveMode = SaveMode::Save) = 0;
     virtual Ret writeToDevice(io::Device* device) = 0;
 
+    //! NOTE Serialises the project on the calling thread, then compresses
+    //! and writes it to the project path on a background thread.
+    //! The project is marked as saved only once the file is in place,
+    //! the result is sent to backgroundSaveFinished() on the calling thread
+    virtual Ret saveInBackground() = 0;
+    virtual async::Channel<Ret> backgroundSaveFinished() const = 0;
+
     virtual ProjectMeta metaInfo() const = 0;
     virtual void setMetaInfo(const ProjectMeta& meta) = 0;
 
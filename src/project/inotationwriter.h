@@ -58,6 +58,13 @@ public:
 
     virtual Ret write(notation::INotationPtr notation, io::Device& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, io::Device& device, const Options& options = Options()) = 0;
+
+    //! NOTE Writes each notation to its own device (in the same order) at once. It is for the formats
+    //! where the parts are cheaper to produce together, e.g. the audio stems rendered in one pass
+    virtual bool supportsWritingPartsAtOnce() const { return false; }
+    virtual Ret writeParts(const notation::INotationPtrList& /*notations*/, const std::vector<io::Device*>& /*devices*/,
+                           const Options& /*options*/ = Options()) { return make_ret(Ret::Code::NotSupported); }
+
     virtual void abort() = 0;
     virtual framework::ProgressChannel progress() const = 0;
 };
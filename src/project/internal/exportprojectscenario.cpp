@@ -94,6 +94,19 @@ bool ExportProjectScenario::exportScores(const INotationPtrList& notations, cons
         }
     } break;
     case INotationWriter::UnitType::PER_PART: {
+        if (!isCreatingOnlyOneFile && writer->supportsWritingPartsAtOnce()) {
+            INotationWriter::Options options {
+                { INotationWriter::OptionKey::UNIT_TYPE, Val(static_cast<int>(unitType)) }
+            };
+
+            auto exportFunction = [writer, options](const INotationPtrList& parts, const std::vector<io::Device*>& destinationDevices) {
+                    return writer->writeParts(parts, destinationDevices, options);
+                };
+
+            doExportPartsLoop(chosenPath, notations, exportFunction);
+            break;
+        }
+
         for (INotationPtr notation : notations) {
             INotationWriter::Options options {
                 { INotationWriter::OptionKey::UNIT_TYPE, Val(static_cast<int>(unitType)) },
@@ -298,3 +311,63 @@ bool ExportProjectScenario::doExportLoop(const io::path& scorePath, std::functio
 
     return true;
 }
+
+bool ExportProjectScenario::doExportPartsLoop(const io::path& basePath, const INotationPtrList& notations,
+                                              std::function<bool(const INotationPtrList&, const std::vector<io::Device*>&)> exportFunction) const
+{
+    IF_ASSERT_FAILED(exportFunction) {
+        return false;
+    }
+
+    INotationPtrList parts;
+    std::vector<io::path> paths;
+
+    for (INotationPtr notation : notations) {
+        io::path path = completeExportPath(basePath, notation, isMainNotation(notation));
+        if (fileSystem()->exists(path) && !shouldReplaceFile(io::filename(path).toQString())) {
+            continue;
+        }
+
+        parts.push_back(notation);
+        paths.push_back(path);
+    }
+
+    if (parts.empty()) {
+        return false;
+    }
+
+    while (true) {
+        std::vector<std::unique_ptr<QFile> > outputFiles;
+        std::vector<io::Device*> destinationDevices;
+        QString failedFilename = io::filename(basePath).toQString();
+        bool isOpened = true;
+
+        for (const io::path& path : paths) {
+            auto outputFile = std::make_unique<QFile>(path.toQString());
+            if (!outputFile->open(QFile::WriteOnly)) {
+                failedFilename = io::filename(path).toQString();
+                isOpened = false;
+                break;
+            }
+
+            destinationDevices.push_back(outputFile.get());
+            outputFiles.push_back(std::move(outputFile));
+        }
+
+        bool ok = isOpened && exportFunction(parts, destinationDevices);
+
+        for (std::unique_ptr<QFile>& outputFile : outputFiles) {
+            outputFile->close();
+        }
+
+        if (ok) {
+            break;
+        }
+
+        if (!askForRetry(failedFilename)) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -67,6 +67,8 @@ private:
     bool askForRetry(const QString& filename) const;
 
     bool doExportLoop(const io::path& path, std::function<bool(io::Device&)> exportFunction) const;
+    bool doExportPartsLoop(const io::path& basePath, const notation::INotationPtrList& notations,
+                           std::function<bool(const notation::INotationPtrList&, const std::vector<io::Device*>&)> exportFunction) const;
 
     mutable FileConflictPolicy m_fileConflictPolicy;
 };
@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include <QBuffer>
+#include <QFileInfo>
 
 #include "stringutils.h"
 #include "framework/global/xmlreader.h"
@@ -36,6 +37,16 @@ using namespace mu::framework;
 using namespace mu::system;
 using namespace mu::engraving;
 
+void MscMetaReader::init(const io::path& indexPath)
+{
+    m_index.load(indexPath);
+}
+
+void MscMetaReader::deinit()
+{
+    m_index.save();
+}
+
 mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
 {
     RetVal<ProjectMeta> meta;
@@ -46,6 +57,48 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
         return meta;
     }
 
+    QImage thumbnail;
+    if (!m_index.find(filePath, meta.val, thumbnail)) {
+        meta.ret = doReadFile(filePath, meta.val, thumbnail);
+        if (!meta.ret) {
+            return meta;
+        }
+
+        m_index.insert(filePath, meta.val, thumbnail);
+    }
+
+    if (!thumbnail.isNull()) {
+        meta.val.thumbnail = QPixmap::fromImage(thumbnail);
+    }
+
+    return meta;
+}
+
+bool MscMetaReader::isMetaIndexed(const io::path& filePath) const
+{
+    return m_index.contains(filePath);
+}
+
+void MscMetaReader::indexMeta(const io::path& filePath) const
+{
+    if (!m_index.isEnabled() || m_index.contains(filePath)) {
+        return;
+    }
+
+    //! NOTE Called from worker threads, so don't use injected services here
+    if (!QFileInfo::exists(filePath.toQString())) {
+        return;
+    }
+
+    ProjectMeta meta;
+    QImage thumbnail;
+    if (doReadFile(filePath, meta, thumbnail)) {
+        m_index.insert(filePath, meta, thumbnail);
+    }
+}
+
+mu::Ret MscMetaReader::doReadFile(const io::path& filePath, ProjectMeta& meta, QImage& thumbnail) const
+{
     MscReader::Params params;
     params.filePath = filePath.toQString();
     params.mode = mcsIoModeBySuffix(io::suffix(filePath));
@@ -59,23 +112,23 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
     // Read score meta
     QByteArray scoreData = msczReader.readScoreFile();
     framework::XmlReader xmlReader(scoreData);
-    doReadMeta(xmlReader, meta.val);
+    doReadMeta(xmlReader, meta);
 
     // Read thumbnail
     QByteArray thumbnailData = msczReader.readThumbnailFile();
     if (thumbnailData.isEmpty()) {
         LOGD() << "Can't find thumbnail";
     } else {
-        meta.val.thumbnail.loadFromData(thumbnailData, "PNG");
+        thumbnail.loadFromData(thumbnailData, "PNG");
     }
 
-    if (meta.val.fileName.empty()) {
-        meta.val.fileName = io::basename(filePath);
+    if (meta.fileName.empty()) {
+        meta.fileName = io::basename(filePath);
     }
 
-    meta.val.filePath = filePath;
+    meta.filePath = filePath;
 
-    return meta;
+    return make_ret(Ret::Code::Ok);
 }
 
 MscMetaReader::RawMeta MscMetaReader::doReadBox(framework::XmlReader& xmlReader) const
@@ -171,31 +224,35 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(framework::XmlReader& xmlRea
                 xmlReader.skipCurrentElement();
             }
         } else if (tag == "Staff") {
-            if (meta.titleStyle.isEmpty()) {
-                while (xmlReader.readNextStartElement()) {
-                    std::string boxTag(xmlReader.tagName());
-
-                    if (boxTag == "HBox"
-                        || boxTag == "VBox"
-                        || boxTag == "TBox"
-                        || boxTag == "FBox") {
-                        RawMeta boxMeta = doReadBox(xmlReader);
-
-                        meta.titleStyle = boxMeta.titleStyle;
-                        meta.titleStyleHtml = boxMeta.titleStyleHtml;
-                        meta.subtitleStyle = boxMeta.subtitleStyle;
-                        meta.subtitleStyleHtml = boxMeta.subtitleStyleHtml;
-                        meta.composerStyle = boxMeta.composerStyle;
-                        meta.composerStyleHtml = boxMeta.composerStyleHtml;
-                        meta.lyricistStyle = boxMeta.lyricistStyle;
-                        meta.lyricistStyleHtml = boxMeta.lyricistStyleHtml;
-                    } else {
-                        xmlReader.skipCurrentElement();
-                    }
+            //! NOTE The meta tags and parts are written before the first staff,
+            //! and its leading frames hold the title, so the rest of the score is not needed
+            while (xmlReader.readNextStartElement()) {
+                std::string boxTag(xmlReader.tagName());
+
+                if (boxTag != "HBox"
+                    && boxTag != "VBox"
+                    && boxTag != "TBox"
+                    && boxTag != "FBox") {
+                    break;
+                }
+
+                RawMeta boxMeta = doReadBox(xmlReader);
+
+                meta.titleStyle = boxMeta.titleStyle;
+                meta.titleStyleHtml = boxMeta.titleStyleHtml;
+                meta.subtitleStyle = boxMeta.subtitleStyle;
+                meta.subtitleStyleHtml = boxMeta.subtitleStyleHtml;
+                meta.composerStyle = boxMeta.composerStyle;
+                meta.composerStyleHtml = boxMeta.composerStyleHtml;
+                meta.lyricistStyle = boxMeta.lyricistStyle;
+                meta.lyricistStyleHtml = boxMeta.lyricistStyleHtml;
+
+                if (!meta.titleStyle.isEmpty() || !meta.titleStyleHtml.isEmpty()) {
+                    break;
                 }
-            } else {
-                xmlReader.skipCurrentElement();
             }
+
+            return meta;
         } else if (tag == "Part") {
             meta.partsCount++;
             xmlReader.skipCurrentElement();
@@ -222,11 +279,15 @@ void MscMetaReader::doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& met
                 while (xmlReader.readNextStartElement()) {
                     if (xmlReader.tagName() == "Score") {
                         rawMeta = doReadRawMeta(xmlReader);
+                        break;
                     } else {
                         xmlReader.skipCurrentElement();
                     }
                 }
             }
+
+            // everything needed has been read, stop parsing here
+            break;
         } else {
             xmlReader.skipCurrentElement();
         }
@@ -27,6 +27,8 @@
 #include "system/ifilesystem.h"
 #include "modularity/ioc.h"
 
+#include "projectmetaindex.h"
+
 namespace mu::framework {
 class XmlReader;
 }
@@ -37,7 +39,13 @@ class MscMetaReader : public IMscMetaReader
     INJECT(project, system::IFileSystem, fileSystem)
 
 public:
-    RetVal<ProjectMeta> readMeta(const io::path& filePath) const;
+    void init(const io::path& indexPath);
+    void deinit();
+
+    RetVal<ProjectMeta> readMeta(const io::path& filePath) const override;
+
+    bool isMetaIndexed(const io::path& filePath) const override;
+    void indexMeta(const io::path& filePath) const override;
 
 private:
 
@@ -67,6 +75,7 @@ private:
         size_t partsCount = 0;
     };
 
+    Ret doReadFile(const io::path& filePath, ProjectMeta& meta, QImage& thumbnail) const;
     void doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const;
     RawMeta doReadBox(framework::XmlReader& xmlReader) const;
     RawMeta doReadRawMeta(framework::XmlReader& xmlReader) const;
@@ -79,6 +88,8 @@ private:
 
     QString readText(framework::XmlReader& xmlReader) const;
     QString readMetaTagText(framework::XmlReader& xmlReader) const;
+
+    mutable ProjectMetaIndex m_index;
 };
 }
 
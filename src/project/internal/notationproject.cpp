@@ -22,8 +22,10 @@
 #include "notationproject.h"
 
 #include <QBuffer>
+#include <QElapsedTimer>
 #include <QFileInfo>
 #include <QFile>
+#include <QtConcurrent>
 
 #include "engraving/engravingproject.h"
 #include "engraving/compat/scoreaccess.h"
@@ -31,6 +33,8 @@
 #include "engraving/infrastructure/io/mscio.h"
 #include "engraving/engravingerrors.h"
 #include "engraving/style/defaultstyle.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/undo.h"
 
 #include "notation/notationerrors.h"
 #include "projectaudiosettings.h"
@@ -83,6 +87,15 @@ NotationProject::NotationProject()
     m_engravingProject = EngravingProject::create();
     m_masterNotation = std::shared_ptr<MasterNotation>(new MasterNotation());
     m_projectAudioSettings = std::shared_ptr<ProjectAudioSettings>(new ProjectAudioSettings());
+
+    QObject::connect(&m_backgroundSaveWatcher, &QFutureWatcher<Ret>::finished, [this]() {
+        onBackgroundSaveFinished(m_backgroundSaveWatcher.result());
+    });
+}
+
+NotationProject::~NotationProject()
+{
+    m_backgroundSave.waitForFinished();
 }
 
 mu::io::path NotationProject::path() const
@@ -325,6 +338,10 @@ mu::Ret NotationProject::writeToDevice(io::Device* device)
     msczWriter.open();
 
     Ret ret = writeProject(msczWriter, false);
+    if (ret) {
+        m_engravingProject->markAsSaved();
+    }
+
     return ret;
 }
 
@@ -354,6 +371,8 @@ mu::Ret NotationProject::saveScore(const io::path& path, SaveMode saveMode)
 
 mu::Ret NotationProject::doSave(bool generateBackup)
 {
+    m_backgroundSave.waitForFinished();
+
     QString currentPath = m_engravingProject->path();
     QString savePath = currentPath + "_saving";
 
@@ -395,22 +414,142 @@ mu::Ret NotationProject::doSave(bool generateBackup)
 
     // Step 4: replace to saved file
     {
-        Ret ret = fileSystem()->move(savePath, currentPath, true);
+        Ret ret = replaceBySavedFile(savePath, currentPath);
         if (!ret) {
             return ret;
         }
     }
 
+    m_engravingProject->markAsSaved();
+
+    LOGI() << "success save file: " << currentPath;
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret NotationProject::replaceBySavedFile(const QString& savePath, const QString& currentPath) const
+{
+    Ret ret = fileSystem()->move(savePath, currentPath, true);
+    if (!ret) {
+        return ret;
+    }
+
     // make file readable by all
-    {
-        QFile::setPermissions(currentPath,
-                              QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
+    QFile::setPermissions(currentPath,
+                          QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret NotationProject::saveInBackground()
+{
+    TRACEFUNC;
+
+    if (m_backgroundSave.isRunning()) {
+        LOGD() << "previous background save is not finished yet";
+        return make_ret(Ret::Code::Ok);
+    }
+
+    QString currentPath = m_engravingProject->path();
+    QString savePath = currentPath + "_saving";
+
+    QFileInfo fi(savePath);
+    if (fi.exists() && !fi.isWritable()) {
+        LOGE() << "failed save, not writable path: " << savePath;
+        return make_ret(notation::Err::UnknownError);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    //! NOTE The score is only serialised here, the zip is made on close
+    std::string suffix = io::suffix(currentPath);
+    MscWriter::Params params;
+    params.filePath = savePath;
+    params.mode = mcsIoModeBySuffix(suffix);
+    params.deferred = true;
+    IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    auto msczWriter = std::make_shared<MscWriter>(params);
+    Ret ret = writeProject(*msczWriter, false);
+    if (!ret) {
+        LOGE() << "failed write project";
+        return ret;
+    }
+
+    LOGI() << "serialised project in " << timer.elapsed() << " ms";
+
+    //! NOTE The project is only marked as saved back on this thread, once the file is in place,
+    //! see onBackgroundSaveFinished()
+    m_backgroundSaveUndoState = m_engravingProject->masterScore()->undoStack()->state();
+
+    //! NOTE Same condition as makeCurrentFileAsBackup(), checked here so that the worker does not read the score
+    const bool generateBackup = created().val;
+
+    m_backgroundSave = QtConcurrent::run([this, msczWriter, savePath, currentPath, generateBackup]() {
+        QElapsedTimer timer;
+        timer.start();
+
+        Ret ret = writeInBackground(*msczWriter, savePath, currentPath, generateBackup);
+        if (ret) {
+            LOGI() << "written project in " << timer.elapsed() << " ms, path: " << currentPath;
+        }
+
+        return ret;
+    });
+
+    m_backgroundSaveWatcher.setFuture(m_backgroundSave);
+
+    return make_ret(Ret::Code::Ok);
+}
+
+void NotationProject::onBackgroundSaveFinished(const Ret& ret)
+{
+    //! NOTE If the score was changed while it was written, the file does not have the changes
+    if (ret && m_engravingProject->masterScore()->undoStack()->state() == m_backgroundSaveUndoState) {
+        m_engravingProject->markAsSaved();
+        m_masterNotation->onSaveCopy();
+    }
+
+    m_backgroundSaveFinished.send(ret);
+}
+
+mu::Ret NotationProject::writeInBackground(MscWriter& msczWriter, const QString& savePath, const QString& currentPath,
+                                           bool generateBackup) const
+{
+    //! NOTE A stale file must not pass for the result of this write
+    if (QFileInfo::exists(savePath) && !QFile::remove(savePath)) {
+        LOGE() << "failed remove previous file: " << savePath;
+        return make_ret(notation::Err::UnknownError);
+    }
+
+    msczWriter.close();
+
+    QFileInfo savedInfo(savePath);
+    if (!savedInfo.exists() || savedInfo.size() == 0) {
+        LOGE() << "failed write file: " << savePath;
+        return make_ret(notation::Err::UnknownError);
+    }
+
+    if (generateBackup) {
+        makeFileAsBackup(currentPath);
+    }
+
+    Ret ret = replaceBySavedFile(savePath, currentPath);
+    if (!ret) {
+        LOGE() << "failed replace file: " << currentPath << ", err: " << ret.toString();
+        return ret;
     }
 
-    LOGI() << "success save file: " << currentPath;
     return make_ret(Ret::Code::Ok);
 }
 
+mu::async::Channel<mu::Ret> NotationProject::backgroundSaveFinished() const
+{
+    return m_backgroundSaveFinished;
+}
+
 mu::Ret NotationProject::makeCurrentFileAsBackup()
 {
     if (!created().val) {
@@ -418,7 +557,11 @@ mu::Ret NotationProject::makeCurrentFileAsBackup()
         return make_ret(Ret::Code::Ok);
     }
 
-    io::path filePath = m_engravingProject->path();
+    return makeFileAsBackup(m_engravingProject->path());
+}
+
+mu::Ret NotationProject::makeFileAsBackup(const io::path& filePath) const
+{
     if (io::suffix(filePath) != engraving::MSCZ) {
         LOGW() << "backup allowed only for MSCZ, currently: " << filePath;
         return make_ret(Ret::Code::Ok);
@@ -494,6 +637,7 @@ mu::Ret NotationProject::saveSelectionOnScore(const mu::io::path& path)
     Ret ret = writeProject(msczWriter, false);
 
     if (ret) {
+        m_engravingProject->markAsSaved();
         QFile::setPermissions(info.filePath(),
                               QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
     }
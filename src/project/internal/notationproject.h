@@ -22,6 +22,9 @@
 #ifndef MU_PROJECT_NOTATIONPROJECT_H
 #define MU_PROJECT_NOTATIONPROJECT_H
 
+#include <QFuture>
+#include <QFutureWatcher>
+
 #include "../inotationproject.h"
 
 #include "modularity/ioc.h"
@@ -50,6 +53,7 @@ class NotationProject : public INotationProject
 
 public:
     NotationProject();
+    ~NotationProject() override;
 
     io::path path() const override;
 
@@ -61,6 +65,8 @@ public:
 
     Ret save(const io::path& path = io::path(), SaveMode saveMode = SaveMode::Save) override;
     Ret writeToDevice(io::Device* device) override;
+    Ret saveInBackground() override;
+    async::Channel<Ret> backgroundSaveFinished() const override;
 
     ProjectMeta metaInfo() const override;
     void setMetaInfo(const ProjectMeta& meta) override;
@@ -78,11 +84,21 @@ private:
     Ret exportProject(const io::path& path, const std::string& suffix);
     Ret doSave(bool generateBackup);
     Ret makeCurrentFileAsBackup();
+    Ret makeFileAsBackup(const io::path& filePath) const;
+    Ret replaceBySavedFile(const QString& savePath, const QString& currentPath) const;
+    Ret writeInBackground(engraving::MscWriter& msczWriter, const QString& savePath, const QString& currentPath,
+                          bool generateBackup) const;
+    void onBackgroundSaveFinished(const Ret& ret);
     Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection);
 
     mu::engraving::EngravingProjectPtr m_engravingProject = nullptr;
     notation::MasterNotationPtr m_masterNotation = nullptr;
     ProjectAudioSettingsPtr m_projectAudioSettings = nullptr;
+
+    QFuture<Ret> m_backgroundSave;
+    QFutureWatcher<Ret> m_backgroundSaveWatcher;
+    int m_backgroundSaveUndoState = 0;
+    async::Channel<Ret> m_backgroundSaveFinished;
 };
 }
 
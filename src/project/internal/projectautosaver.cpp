@@ -69,11 +69,21 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
-    Ret ret = project->save();
+    project->backgroundSaveFinished().onReceive(this, [](const Ret& ret) {
+        if (!ret) {
+            LOGE() << "[autosave] failed to write project, err: " << ret.toString();
+            return;
+        }
+
+        LOGD() << "[autosave] project saved";
+    });
+
+    //! NOTE Only the serialisation blocks the UI, the project is written in the background
+    Ret ret = project->saveInBackground();
     if (!ret) {
         LOGE() << "[autosave] failed to save project, err: " << ret.toString();
         return;
     }
 
-    LOGD() << "[autosave] successfully saved project";
+    LOGD() << "[autosave] started saving project";
 }
@@ -140,6 +140,11 @@ io::path ProjectConfiguration::myFirstProjectPath() const
     return appTemplatesPath() + "/My_First_Score.mscx";
 }
 
+io::path ProjectConfiguration::projectMetaIndexPath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/projectmeta.idx";
+}
+
 io::path ProjectConfiguration::appTemplatesPath() const
 {
     return globalConfiguration()->appDataPath() + "/templates";
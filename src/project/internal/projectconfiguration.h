@@ -50,6 +50,8 @@ public:
 
     io::path myFirstProjectPath() const override;
 
+    io::path projectMetaIndexPath() const override;
+
     io::paths availableTemplatesPaths() const override;
 
     io::path userTemplatesPath() const override;
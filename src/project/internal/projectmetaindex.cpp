@@ -0,0 +1,215 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "projectmetaindex.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QDataStream>
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::project;
+
+static constexpr quint32 INDEX_MAGIC = 0x4d534d49; // "MSMI"
+static constexpr quint32 INDEX_VERSION = 1;
+
+static QDataStream& operator<<(QDataStream& stream, const ProjectMeta& meta)
+{
+    stream << meta.fileName.toQString() << meta.filePath.toQString()
+           << meta.title << meta.subtitle << meta.composer << meta.lyricist
+           << meta.copyright << meta.translator << meta.arranger
+           << quint64(meta.partsCount) << meta.creationDate
+           << meta.source << meta.platform << meta.musescoreVersion
+           << qint32(meta.musescoreRevision) << qint32(meta.mscVersion)
+           << meta.additionalTags;
+
+    return stream;
+}
+
+static QDataStream& operator>>(QDataStream& stream, ProjectMeta& meta)
+{
+    QString fileName;
+    QString filePath;
+    quint64 partsCount = 0;
+    qint32 musescoreRevision = 0;
+    qint32 mscVersion = 0;
+
+    stream >> fileName >> filePath
+    >> meta.title >> meta.subtitle >> meta.composer >> meta.lyricist
+    >> meta.copyright >> meta.translator >> meta.arranger
+    >> partsCount >> meta.creationDate
+    >> meta.source >> meta.platform >> meta.musescoreVersion
+    >> musescoreRevision >> mscVersion
+    >> meta.additionalTags;
+
+    meta.fileName = fileName;
+    meta.filePath = filePath;
+    meta.partsCount = partsCount;
+    meta.musescoreRevision = musescoreRevision;
+    meta.mscVersion = mscVersion;
+
+    return stream;
+}
+
+void ProjectMetaIndex::load(const io::path& indexPath)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_indexPath = indexPath;
+    m_entries.clear();
+    m_changed = false;
+
+    QFile file(indexPath.toQString());
+    if (!file.exists()) {
+        return;
+    }
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        LOGE() << "failed open meta index: " << indexPath;
+        return;
+    }
+
+    QDataStream stream(&file);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != INDEX_MAGIC || version != INDEX_VERSION) {
+        LOGI() << "meta index has unsupported format, it will be rebuilt";
+        return;
+    }
+
+    quint32 count = 0;
+    stream >> count;
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString path;
+        Entry entry;
+        stream >> path >> entry.size >> entry.lastModified >> entry.meta >> entry.thumbnail;
+        m_entries.insert(path, std::move(entry));
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        LOGE() << "meta index is corrupted, it will be rebuilt";
+        m_entries.clear();
+    }
+}
+
+void ProjectMetaIndex::save()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_indexPath.empty()) {
+        return;
+    }
+
+    //! NOTE Drop the entries of files which were removed or moved, so the index doesn't grow forever
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (QFileInfo::exists(it.key())) {
+            ++it;
+            continue;
+        }
+
+        it = m_entries.erase(it);
+        m_changed = true;
+    }
+
+    if (!m_changed) {
+        return;
+    }
+
+    QSaveFile file(m_indexPath.toQString());
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open meta index for writing: " << m_indexPath;
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << INDEX_MAGIC << INDEX_VERSION << quint32(m_entries.size());
+    for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it) {
+        const Entry& entry = it.value();
+        stream << it.key() << entry.size << entry.lastModified << entry.meta << entry.thumbnail;
+    }
+
+    if (!file.commit()) {
+        LOGE() << "failed write meta index: " << m_indexPath;
+        return;
+    }
+
+    m_changed = false;
+}
+
+bool ProjectMetaIndex::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_indexPath.empty();
+}
+
+bool ProjectMetaIndex::isUpToDate(const Entry& entry, const QFileInfo& fileInfo) const
+{
+    return entry.size == fileInfo.size() && entry.lastModified == fileInfo.lastModified();
+}
+
+bool ProjectMetaIndex::contains(const io::path& filePath) const
+{
+    QFileInfo fileInfo(filePath.toQString());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.constFind(filePath.toQString());
+    return it != m_entries.cend() && isUpToDate(it.value(), fileInfo);
+}
+
+bool ProjectMetaIndex::find(const io::path& filePath, ProjectMeta& meta, QImage& thumbnail) const
+{
+    QFileInfo fileInfo(filePath.toQString());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.constFind(filePath.toQString());
+    if (it == m_entries.cend() || !isUpToDate(it.value(), fileInfo)) {
+        return false;
+    }
+
+    meta = it.value().meta;
+    thumbnail = it.value().thumbnail;
+
+    return true;
+}
+
+void ProjectMetaIndex::insert(const io::path& filePath, const ProjectMeta& meta, const QImage& thumbnail)
+{
+    QFileInfo fileInfo(filePath.toQString());
+
+    Entry entry;
+    entry.size = fileInfo.size();
+    entry.lastModified = fileInfo.lastModified();
+    entry.meta = meta;
+    entry.thumbnail = thumbnail;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_indexPath.empty()) {
+        return;
+    }
+
+    m_entries.insert(filePath.toQString(), std::move(entry));
+    m_changed = true;
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PROJECT_PROJECTMETAINDEX_H
+#define MU_PROJECT_PROJECTMETAINDEX_H
+
+#include <mutex>
+
+#include <QHash>
+#include <QDateTime>
+#include <QImage>
+
+#include "io/path.h"
+#include "projecttypes.h"
+
+class QFileInfo;
+
+namespace mu::project {
+//! NOTE On-disk index of project meta and thumbnails, keyed by file path.
+//! An entry is only used while the size and modification time of the file are unchanged.
+//! Thread safe, thumbnails are kept as QImage so that entries can be filled outside the main thread,
+//! the meta passed to insert() is expected to have no pixmap set.
+class ProjectMetaIndex
+{
+public:
+    void load(const io::path& indexPath);
+    void save();
+
+    bool isEnabled() const;
+
+    bool contains(const io::path& filePath) const;
+    bool find(const io::path& filePath, ProjectMeta& meta, QImage& thumbnail) const;
+    void insert(const io::path& filePath, const ProjectMeta& meta, const QImage& thumbnail);
+
+private:
+    struct Entry {
+        qint64 size = 0;
+        QDateTime lastModified;
+        ProjectMeta meta;
+        QImage thumbnail;
+    };
+
+    bool isUpToDate(const Entry& entry, const QFileInfo& fileInfo) const;
+
+    io::path m_indexPath;
+    QHash<QString, Entry> m_entries;
+    bool m_changed = false;
+    mutable std::mutex m_mutex;
+};
+}
+
+#endif // MU_PROJECT_PROJECTMETAINDEX_H
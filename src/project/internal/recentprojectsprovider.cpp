@@ -21,6 +21,8 @@
  */
 #include "recentprojectsprovider.h"
 
+#include <QtConcurrent>
+
 #include "log.h"
 
 using namespace mu::project;
@@ -32,16 +34,39 @@ void RecentProjectsProvider::init()
 
     configuration()->recentProjectPathsChanged().onReceive(this, [this](const io::paths&) {
         m_dirty = true;
+        m_indexedInBackground.clear();
         m_recentListChanged.notify();
     });
+
+    m_backgroundIndexingFinished.onReceive(this, [this](const io::path& path) {
+        m_indexingInBackground.erase(path);
+        m_indexedInBackground.insert(path);
+        m_dirty = true;
+        m_recentListChanged.notify();
+    }, Asyncable::AsyncMode::AsyncSetRepeat);
 }
 
 ProjectMetaList RecentProjectsProvider::recentProjectList() const
 {
     if (m_dirty) {
         io::paths paths = configuration()->recentProjectPaths();
+        io::paths notIndexedPaths;
         m_recentList.clear();
         for (const io::path& path : paths) {
+            //! NOTE Files which are not in the meta index yet are read in the background,
+            //! until then only their file name is shown
+            bool readInBackground = !m_indexedInBackground.count(path) && !mscMetaReader()->isMetaIndexed(path);
+            if (readInBackground && fileSystem()->exists(path)) {
+                ProjectMeta meta;
+                meta.filePath = path;
+                meta.fileName = io::basename(path);
+                m_recentList.push_back(std::move(meta));
+                if (m_indexingInBackground.insert(path).second) {
+                    notIndexedPaths.push_back(path);
+                }
+                continue;
+            }
+
             RetVal<ProjectMeta> meta = mscMetaReader()->readMeta(path);
             if (!meta.ret) {
                 LOGE() << "failed read meta, path: " << path;
@@ -50,11 +75,33 @@ ProjectMetaList RecentProjectsProvider::recentProjectList() const
             m_recentList.push_back(std::move(meta.val));
         }
         m_dirty = false;
+
+        if (!notIndexedPaths.empty()) {
+            indexInBackground(notIndexedPaths);
+        }
     }
 
     return m_recentList;
 }
 
+void RecentProjectsProvider::indexInBackground(const io::paths& paths) const
+{
+    TRACEFUNC;
+
+    //! NOTE Each path is reported as soon as it is indexed, so the list is filled progressively.
+    //! Paths which are still not indexed afterwards (unreadable files or disabled index)
+    //! are read synchronously on the next update, so this is done once per path
+    std::shared_ptr<IMscMetaReader> reader = mscMetaReader();
+    async::Channel<io::path> indexed = m_backgroundIndexingFinished;
+
+    QtConcurrent::run([reader, paths, indexed]() mutable {
+        for (const io::path& path : paths) {
+            reader->indexMeta(path);
+            indexed.send(path);
+        }
+    });
+}
+
 mu::async::Notification RecentProjectsProvider::recentProjectListChanged() const
 {
     return m_recentListChanged;
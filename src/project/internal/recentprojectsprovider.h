@@ -22,17 +22,22 @@
 #ifndef MU_PROJECT_RECENTPROJECTSPROVIDER_H
 #define MU_PROJECT_RECENTPROJECTSPROVIDER_H
 
+#include <set>
+
 #include "irecentprojectsprovider.h"
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
+#include "async/channel.h"
 #include "iprojectconfiguration.h"
 #include "imscmetareader.h"
+#include "system/ifilesystem.h"
 
 namespace mu::project {
 class RecentProjectsProvider : public IRecentProjectsProvider, public async::Asyncable
 {
     INJECT(project, IProjectConfiguration, configuration)
     INJECT(project, IMscMetaReader, mscMetaReader)
+    INJECT(project, system::IFileSystem, fileSystem)
 
 public:
     void init();
@@ -41,9 +46,13 @@ public:
     async::Notification recentProjectListChanged() const override;
 
 private:
+    void indexInBackground(const io::paths& paths) const;
 
     mutable bool m_dirty = true;
     mutable ProjectMetaList m_recentList;
+    mutable std::set<io::path> m_indexingInBackground;
+    mutable std::set<io::path> m_indexedInBackground;
+    mutable async::Channel<io::path> m_backgroundIndexingFinished;
     async::Notification m_recentListChanged;
 };
 }
@@ -22,6 +22,8 @@
 
 #include "templatesrepository.h"
 
+#include <QtConcurrent>
+
 #include "log.h"
 
 #include "io/path.h"
@@ -31,7 +33,31 @@ using namespace mu::project;
 
 RetVal<Templates> TemplatesRepository::templates() const
 {
-    Templates result;
+    //! NOTE If the templates are still being indexed, wait for it rather than reading the same files twice
+    m_indexing.waitForFinished();
+
+    Templates result = loadTemplates(templatesFilePaths());
+    return RetVal<Templates>::make_ok(result);
+}
+
+void TemplatesRepository::indexTemplatesInBackground() const
+{
+    TRACEFUNC;
+
+    //! NOTE Fills the meta index, so that templates() doesn't need to read the files
+    std::shared_ptr<IMscMetaReader> reader = mscReader();
+    io::paths filePaths = templatesFilePaths();
+
+    m_indexing = QtConcurrent::run([reader, filePaths]() {
+        for (const io::path& path : filePaths) {
+            reader->indexMeta(path);
+        }
+    });
+}
+
+io::paths TemplatesRepository::templatesFilePaths() const
+{
+    io::paths result;
 
     for (const io::path& dirPath: configuration()->availableTemplatesPaths()) {
         QStringList filters { "*.mscz", "*.mscx" };
@@ -42,10 +68,10 @@ RetVal<Templates> TemplatesRepository::templates() const
             continue;
         }
 
-        result << loadTemplates(files.val);
+        result.insert(result.end(), files.val.begin(), files.val.end());
     }
 
-    return RetVal<Templates>::make_ok(result);
+    return result;
 }
 
 Templates TemplatesRepository::loadTemplates(const io::paths& filePaths) const
@@ -23,6 +23,8 @@
 #ifndef MU_PROJECT_TEMPLATESREPOSITORY_H
 #define MU_PROJECT_TEMPLATESREPOSITORY_H
 
+#include <QFuture>
+
 #include "modularity/ioc.h"
 
 #include "itemplatesrepository.h"
@@ -40,9 +42,14 @@ class TemplatesRepository : public ITemplatesRepository
 public:
     RetVal<Templates> templates() const override;
 
+    void indexTemplatesInBackground() const;
+
 private:
+    io::paths templatesFilePaths() const;
     Templates loadTemplates(const io::paths& filePaths) const;
     QString correctedTitle(const QString& title) const;
+
+    mutable QFuture<void> m_indexing;
 };
 }
 
@@ -45,6 +45,8 @@ public:
 
     virtual io::path myFirstProjectPath() const = 0;
 
+    virtual io::path projectMetaIndexPath() const = 0;
+
     virtual io::paths availableTemplatesPaths() const = 0;
 
     virtual io::path userTemplatesPath() const = 0;
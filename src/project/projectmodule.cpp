@@ -62,6 +62,8 @@ using namespace mu::modularity;
 static std::shared_ptr<ProjectConfiguration> s_configuration = std::make_shared<ProjectConfiguration>();
 static std::shared_ptr<ProjectFilesController> s_fileController = std::make_shared<ProjectFilesController>();
 static std::shared_ptr<RecentProjectsProvider> s_recentProjectsProvider = std::make_shared<RecentProjectsProvider>();
+static std::shared_ptr<MscMetaReader> s_mscMetaReader = std::make_shared<MscMetaReader>();
+static std::shared_ptr<TemplatesRepository> s_templatesRepository = std::make_shared<TemplatesRepository>();
 
 static void project_init_qrc()
 {
@@ -82,8 +84,8 @@ void ProjectModule::registerExports()
     ioc()->registerExport<IProjectFilesController>(moduleName(), s_fileController);
     ioc()->registerExport<IExportProjectScenario>(moduleName(), new ExportProjectScenario());
     ioc()->registerExport<IRecentProjectsProvider>(moduleName(), s_recentProjectsProvider);
-    ioc()->registerExport<IMscMetaReader>(moduleName(), new MscMetaReader());
-    ioc()->registerExport<ITemplatesRepository>(moduleName(), new TemplatesRepository());
+    ioc()->registerExport<IMscMetaReader>(moduleName(), s_mscMetaReader);
+    ioc()->registerExport<ITemplatesRepository>(moduleName(), s_templatesRepository);
     ioc()->registerExport<IProjectMigrator>(moduleName(), new ProjectMigrator());
 
 #ifdef Q_OS_MAC
@@ -134,9 +136,20 @@ void ProjectModule::onInit(const framework::IApplication::RunMode& mode)
     }
 
     s_configuration->init();
+    s_mscMetaReader->init(s_configuration->projectMetaIndexPath());
     s_fileController->init();
     s_recentProjectsProvider->init();
 
     static ProjectAutoSaver autoSaver;
     autoSaver.init();
 }
+
+void ProjectModule::onDelayedInit()
+{
+    s_templatesRepository->indexTemplatesInBackground();
+}
+
+void ProjectModule::onDeinit()
+{
+    s_mscMetaReader->deinit();
+}
@@ -35,6 +35,8 @@ public:
     void registerResources() override;
     void registerUiTypes() override;
     void onInit(const framework::IApplication::RunMode& mode) override;
+    void onDelayedInit() override;
+    void onDeinit() override;
 };
 }
 
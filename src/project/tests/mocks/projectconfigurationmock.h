@@ -36,6 +36,8 @@ public:
 
     MOCK_METHOD(io::path, myFirstProjectPath, (), (const, override));
 
+    MOCK_METHOD(io::path, projectMetaIndexPath, (), (const, override));
+
     MOCK_METHOD(io::paths, availableTemplatesPaths, (), (const, override));
 
     MOCK_METHOD(io::path, userTemplatesPath, (), (const, override));
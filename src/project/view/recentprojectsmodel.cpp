@@ -101,6 +101,25 @@ void RecentProjectsModel::setRecentScores(const QVariantList& recentScores)
         return;
     }
 
+    //! NOTE Recent files are read in the background and arrive one by one,
+    //! so if only their meta has changed, update just those rows
+    if (m_recentScores.size() == recentScores.size()) {
+        bool samePaths = true;
+        for (int i = 0; i < recentScores.size() && samePaths; ++i) {
+            samePaths = m_recentScores[i].toMap()[SCORE_PATH_KEY] == recentScores[i].toMap()[SCORE_PATH_KEY];
+        }
+
+        if (samePaths) {
+            for (int i = 0; i < recentScores.size(); ++i) {
+                if (m_recentScores[i] != recentScores[i]) {
+                    m_recentScores[i] = recentScores[i];
+                    emit dataChanged(index(i), index(i));
+                }
+            }
+            return;
+        }
+    }
+
     beginResetModel();
     m_recentScores = recentScores;
     endResetModel();
@@ -78,3 +78,12 @@ async::Notification AudioConfigurationStub::synthesizerStateGroupChanged(const s
 {
     return async::Notification();
 }
+
+AudioTelemetryData AudioConfigurationStub::telemetryData() const
+{
+    return AudioTelemetryData();
+}
+
+void AudioConfigurationStub::resetTelemetryData()
+{
+}
@@ -46,6 +46,10 @@ public:
     Ret saveSynthesizerState(const synth::SynthesizerState& state) override;
     async::Notification synthesizerStateChanged() const override;
     async::Notification synthesizerStateGroupChanged(const std::string& groupName) const override;
+
+    // diagnostics
+    AudioTelemetryData telemetryData() const override;
+    void resetTelemetryData() override;
 };
 }
 
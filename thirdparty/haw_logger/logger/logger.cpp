@@ -47,19 +47,33 @@ DateTime DateTime::now()
     milliseconds ms_d = duration_cast< milliseconds >(system_clock::now().time_since_epoch());
 
     std::time_t sec = static_cast<std::time_t>(ms_d.count() / 1000);
-    std::tm* tm = std::localtime(&sec);
-    assert(tm);
-    if (!tm) {
-        return DateTime();
-    }
-
-    DateTime dt;
-    dt.date.year = tm->tm_year + 1900;
-    dt.date.mon = tm->tm_mon + 1;
-    dt.date.day = tm->tm_mday;
-    dt.time.hour = tm->tm_hour;
-    dt.time.min = tm->tm_min;
-    dt.time.sec = tm->tm_sec;
+
+    //! NOTE Converting to the local time is expensive, so do it once a second per thread
+    thread_local std::time_t lastSec = -1;
+    thread_local DateTime lastDt;
+
+    if (sec != lastSec) {
+        std::tm tm {};
+#ifdef _WIN32
+        bool ok = localtime_s(&tm, &sec) == 0;
+#else
+        bool ok = localtime_r(&sec, &tm) != nullptr;
+#endif
+        assert(ok);
+        if (!ok) {
+            return DateTime();
+        }
+
+        lastDt.date.year = tm.tm_year + 1900;
+        lastDt.date.mon = tm.tm_mon + 1;
+        lastDt.date.day = tm.tm_mday;
+        lastDt.time.hour = tm.tm_hour;
+        lastDt.time.min = tm.tm_min;
+        lastDt.time.sec = tm.tm_sec;
+        lastSec = sec;
+    }
+
+    DateTime dt = lastDt;
     dt.time.msec = ms_d.count() - (sec * 1000);
 
     return dt;
@@ -288,6 +302,7 @@ Logger::~Logger()
 #ifdef HAW_LOGGER_QT_SUPPORT
     setIsCatchQtMsg(false);
 #endif
+    setIsAsync(false);
     clearDests();
 }
 
@@ -311,11 +326,33 @@ void Logger::setupDefault()
 
 void Logger::write(const LogMsg& logMsg)
 {
+    if (m_isAsync.load()) {
+        write(LogMsg(logMsg));
+        return;
+    }
+
     std::lock_guard<std::mutex> locker(m_mutex);
     if (isAsseptMsg(logMsg.type)) {
-        for (LogDest* dest : m_dests) {
-            dest->write(logMsg);
-        }
+        writeToDests(logMsg);
+    }
+}
+
+void Logger::write(LogMsg&& logMsg)
+{
+    if (m_isAsync.load() && isAsseptMsg(logMsg.type) && pushAsync(std::move(logMsg))) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (isAsseptMsg(logMsg.type)) {
+        writeToDests(logMsg);
+    }
+}
+
+void Logger::writeToDests(const LogMsg& logMsg)
+{
+    for (LogDest* dest : m_dests) {
+        dest->write(logMsg);
     }
 }
 
@@ -335,16 +372,19 @@ bool Logger::isType(const Type& type) const
 void Logger::addDest(LogDest* dest)
 {
     assert(dest);
+    std::lock_guard<std::mutex> locker(m_mutex);
     m_dests.push_back(dest);
 }
 
 std::vector<LogDest*> Logger::dests() const
 {
+    std::lock_guard<std::mutex> locker(m_mutex);
     return m_dests;
 }
 
 void Logger::clearDests()
 {
+    std::lock_guard<std::mutex> locker(m_mutex);
     for (LogDest* d : m_dests) {
         delete d;
     }
@@ -382,6 +422,217 @@ void Logger::setType(const Type& type, bool enb)
     }
 }
 
+// Async ---------------------------------
+
+Logger::Queue::Queue(size_t capacity)
+{
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    msgs.resize(size);
+    mask = size - 1;
+}
+
+bool Logger::Queue::push(LogMsg&& logMsg)
+{
+    uint64_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) >= msgs.size()) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    msgs[t & mask] = std::move(logMsg);
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+void Logger::setIsAsync(bool arg, size_t queueCapacity)
+{
+    if (arg == m_isAsync.load()) {
+        return;
+    }
+
+    if (arg) {
+        m_queueCapacity = queueCapacity < 1 ? 1 : queueCapacity;
+        {
+            std::lock_guard<std::mutex> locker(m_asyncMutex);
+            m_droppedOfRemoved = 0;
+            m_reportedDropped = 0;
+        }
+        m_asyncRunning.store(true);
+        m_asyncThread = std::thread([this]() { asyncLoop(); });
+        m_isAsync.store(true, std::memory_order_release);
+    } else {
+        //! NOTE Wait for the producers which have seen the async mode, so nothing is pushed after the join
+        m_isAsync.store(false);
+        while (m_asyncProducers.load() > 0) {
+            std::this_thread::yield();
+        }
+
+        m_asyncRunning.store(false);
+        m_asyncCond.notify_one();
+        m_asyncThread.join(); //! NOTE Writes the rest of the messages
+
+        std::lock_guard<std::mutex> locker(m_asyncMutex);
+        for (const std::shared_ptr<Queue>& q : m_queues) {
+            m_droppedOfRemoved += q->dropped.load();
+        }
+        m_queues.clear();
+        ++m_queuesGeneration;
+    }
+}
+
+bool Logger::isAsync() const
+{
+    return m_isAsync.load();
+}
+
+uint64_t Logger::droppedCount() const
+{
+    std::lock_guard<std::mutex> locker(m_asyncMutex);
+    uint64_t dropped = m_droppedOfRemoved;
+    for (const std::shared_ptr<Queue>& q : m_queues) {
+        dropped += q->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void Logger::flush()
+{
+    if (!m_isAsync.load()) {
+        return;
+    }
+
+    std::vector<std::pair<std::shared_ptr<Queue>, uint64_t> > targets;
+    {
+        std::lock_guard<std::mutex> locker(m_asyncMutex);
+        for (const std::shared_ptr<Queue>& q : m_queues) {
+            targets.push_back({ q, q->tail.load(std::memory_order_acquire) });
+        }
+    }
+
+    for (const auto& t : targets) {
+        while (t.first->head.load(std::memory_order_acquire) < t.second && m_asyncRunning.load()) {
+            m_asyncCond.notify_one();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+Logger::Queue* Logger::threadQueue()
+{
+    //! NOTE The queue lives while it is used by the thread or has messages
+    struct Holder {
+        std::shared_ptr<Queue> queue;
+        uint64_t generation = 0;
+
+        ~Holder()
+        {
+            if (queue) {
+                queue->isThreadFinished.store(true);
+            }
+        }
+    };
+
+    thread_local Holder holder;
+
+    uint64_t generation = m_queuesGeneration.load();
+    if (!holder.queue || holder.generation != generation) {
+        std::lock_guard<std::mutex> locker(m_asyncMutex);
+        holder.queue = std::make_shared<Queue>(m_queueCapacity);
+        holder.generation = generation;
+        m_queues.push_back(holder.queue);
+    }
+
+    return holder.queue.get();
+}
+
+bool Logger::pushAsync(LogMsg&& logMsg)
+{
+    m_asyncProducers.fetch_add(1);
+    if (!m_isAsync.load()) {
+        m_asyncProducers.fetch_sub(1);
+        return false;
+    }
+
+    //! NOTE Errors are written at once, after the queued messages, so they are not lost at a crash
+    if (logMsg.type == ERRR) {
+        flush();
+        m_asyncProducers.fetch_sub(1);
+        return false;
+    }
+
+    threadQueue()->push(std::move(logMsg));
+
+    if (m_asyncSleeping.load(std::memory_order_relaxed)) {
+        m_asyncCond.notify_one();
+    }
+
+    m_asyncProducers.fetch_sub(1);
+    return true;
+}
+
+bool Logger::writeQueued()
+{
+    std::vector<std::shared_ptr<Queue> > queues;
+    uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> locker(m_asyncMutex);
+        auto isRemoved = [this](const std::shared_ptr<Queue>& q) {
+            if (q->isThreadFinished.load() && q->head.load() == q->tail.load()) {
+                m_droppedOfRemoved += q->dropped.load();
+                return true;
+            }
+            return false;
+        };
+        m_queues.erase(std::remove_if(m_queues.begin(), m_queues.end(), isRemoved), m_queues.end());
+        queues = m_queues;
+        dropped = m_droppedOfRemoved;
+    }
+
+    bool hasWritten = false;
+
+    std::lock_guard<std::mutex> locker(m_mutex);
+    for (const std::shared_ptr<Queue>& q : queues) {
+        uint64_t h = q->head.load(std::memory_order_relaxed);
+        uint64_t t = q->tail.load(std::memory_order_acquire);
+        for (; h < t; ++h) {
+            LogMsg logMsg = std::move(q->msgs[h & q->mask]);
+            writeToDests(logMsg);
+            //! NOTE Advanced after the write, so flush() returns only when the message is written
+            q->head.store(h + 1, std::memory_order_release);
+            hasWritten = true;
+        }
+
+        dropped += q->dropped.load(std::memory_order_relaxed);
+    }
+
+    if (dropped > m_reportedDropped) {
+        writeToDests(LogMsg(WARN, "Logger", "dropped messages (the queue is full): " + std::to_string(dropped - m_reportedDropped)));
+        m_reportedDropped = dropped;
+    }
+
+    return hasWritten;
+}
+
+void Logger::asyncLoop()
+{
+    while (m_asyncRunning.load()) {
+        if (writeQueued()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(m_asyncMutex);
+        m_asyncSleeping.store(true);
+        m_asyncCond.wait_for(locker, std::chrono::milliseconds(100));
+        m_asyncSleeping.store(false);
+    }
+
+    writeQueued();
+}
+
 #ifdef HAW_LOGGER_QT_SUPPORT
 void Logger::logMsgHandler(QtMsgType type, const QMessageLogContext& ctx, const QString& s)
 {
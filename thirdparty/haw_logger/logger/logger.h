@@ -5,6 +5,9 @@
 #include <thread>
 #include <vector>
 #include <mutex>
+#include <memory>
+#include <atomic>
+#include <condition_variable>
 
 #include "logstream.h"
 
@@ -157,15 +160,44 @@ public:
 #endif
 
     void write(const LogMsg& logMsg);
+    void write(LogMsg&& logMsg);
 
     void addDest(LogDest* dest);
     std::vector<LogDest*> dests() const;
     void clearDests();
 
+    //! NOTE In the async mode messages are pushed to a bounded queue of the calling thread
+    //! and are formatted and written to the destinations by a background thread.
+    //! If a queue is full, the message is dropped. Errors (also Qt critical and fatal messages)
+    //! are written synchronously, after the queued messages of all threads.
+    void setIsAsync(bool arg, size_t queueCapacity = 1024);
+    bool isAsync() const;
+    void flush(); //! NOTE Waits until all queued messages are written
+    uint64_t droppedCount() const; //! NOTE Since the async mode was switched on
+
 private:
     Logger();
     ~Logger();
 
+    //! NOTE Single producer (the owner thread), single consumer (the writer thread)
+    struct Queue {
+        std::vector<LogMsg> msgs;
+        size_t mask = 0;
+        std::atomic<uint64_t> head { 0 };
+        std::atomic<uint64_t> tail { 0 };
+        std::atomic<uint64_t> dropped { 0 };
+        std::atomic<bool> isThreadFinished { false };
+
+        explicit Queue(size_t capacity);
+        bool push(LogMsg&& logMsg);
+    };
+
+    Queue* threadQueue();
+    bool pushAsync(LogMsg&& logMsg); //! NOTE Returns false if the message has to be written synchronously
+    void writeToDests(const LogMsg& logMsg);
+    bool writeQueued();
+    void asyncLoop();
+
 #ifdef HAW_LOGGER_QT_SUPPORT
     static void logMsgHandler(QtMsgType, const QMessageLogContext&, const QString&);
     static Type qtMsgTypeToString(enum QtMsgType defType);
@@ -174,7 +206,20 @@ private:
     Level m_level = Normal;
     std::vector<LogDest*> m_dests;
     std::vector<Type> m_types;
-    std::mutex m_mutex;
+    mutable std::mutex m_mutex;
+
+    std::atomic<bool> m_isAsync { false };
+    size_t m_queueCapacity = 1024;
+    std::thread m_asyncThread;
+    std::atomic<bool> m_asyncRunning { false };
+    std::atomic<bool> m_asyncSleeping { false };
+    std::atomic<int> m_asyncProducers { 0 };
+    mutable std::mutex m_asyncMutex;
+    std::condition_variable m_asyncCond;
+    std::vector<std::shared_ptr<Queue> > m_queues; //! NOTE Under m_asyncMutex
+    std::atomic<uint64_t> m_queuesGeneration { 0 };
+    uint64_t m_reportedDropped = 0;
+    uint64_t m_droppedOfRemoved = 0;
 };
 
 //! LogInput ---------------------------------
@@ -187,7 +232,7 @@ public:
     ~LogInput()
     {
         m_msg.message = m_stream.str();
-        Logger::instance()->write(m_msg);
+        Logger::instance()->write(std::move(m_msg));
     }
 
     Stream& stream() { return m_stream; }
@@ -110,6 +110,13 @@ public:
 
         MYTRACE() << "This my trace"; //! NOTE Not output
 
+        //! Async mode - messages are written by a background thread,
+        //! if the queue of a thread is full, its messages are dropped
+        logger->setIsAsync(true);
+        LOGI() << "This is info from the queue";
+        logger->flush();
+        logger->setIsAsync(false);
+
         //! Custom LogLayout - inherits of the LogLayout and override method "output"
         //! Custom LogDest - inherits of the LogDest and override method "write"
         //! Custom log macro - see log.h
@@ -10,6 +10,7 @@
 using namespace haw::profiler;
 
 Profiler::Options Profiler::m_options;
+std::atomic<bool> Profiler::m_timelineActive(false);
 
 constexpr int MAIN_THREAD_INDEX(0);
 
@@ -26,6 +27,11 @@ Profiler::Profiler()
 
 Profiler::~Profiler()
 {
+    m_timelineActive.store(false);
+    for (std::atomic<TimelineBuffer*>& buf : m_timeline.buffers) {
+        delete buf.load();
+    }
+
     delete m_printer;
 }
 
@@ -42,6 +48,12 @@ void Profiler::setup(const Options& opt, Printer* printer)
     std::fill(m_funcs.threads.begin(), m_funcs.threads.end(), std::thread::id());
     m_funcs.threads[MAIN_THREAD_INDEX] = std::this_thread::get_id();
 
+    //! Timeline
+    for (std::atomic<TimelineBuffer*>& buf : m_timeline.buffers) {
+        delete buf.load();
+    }
+    m_timeline.buffers = std::vector<std::atomic<TimelineBuffer*> >(m_options.funcsMaxThreadCount);
+
     if (printer) {
         delete m_printer;
         m_printer = printer;
@@ -79,6 +91,18 @@ void Profiler::stepTime(const std::string& tag, const std::string& info, bool is
     printer()->printStep(tag, timer->beginMs(), timer->stepMs(), info);
 
     timer->nextStep();
+
+    if (isTimelineActive() && m_timeline.instants.size() < m_options.timelineMaxEventsPerThread) {
+        std::thread::id th = std::this_thread::get_id();
+        int idx = m_funcs.threadIndex(th);
+        if (idx == -1) {
+            idx = m_funcs.addThread(th);
+        }
+
+        if (idx > -1) {
+            m_timeline.instants.push_back({ tag + ": " + info, timelineTime(), idx });
+        }
+    }
 }
 
 Profiler::FuncTimer* Profiler::beginFunc(const std::string& func)
@@ -245,6 +269,198 @@ bool Profiler::save(const std::string& filePath)
     return ok;
 }
 
+void Profiler::startTimeline()
+{
+    std::lock_guard<std::mutex> lock(m_steps.mutex);
+
+    m_timeline.instants.clear();
+    m_timeline.beginNs = timelineTime();
+    m_timeline.endNs = m_timeline.beginNs;
+
+    //! NOTE The buffers of the previous capture are reset by their threads on the first event
+    m_timeline.captureId.fetch_add(1);
+    m_timelineActive.store(true);
+}
+
+void Profiler::stopTimeline()
+{
+    std::lock_guard<std::mutex> lock(m_steps.mutex);
+
+    if (m_timelineActive.exchange(false)) {
+        m_timeline.endNs = timelineTime();
+    }
+}
+
+bool Profiler::isTimelineActive()
+{
+    return m_timelineActive.load(std::memory_order_relaxed);
+}
+
+int64_t Profiler::timelineTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Profiler::TimelineBuffer* Profiler::timelineBuffer()
+{
+    std::thread::id th = std::this_thread::get_id();
+    int idx = m_funcs.threadIndex(th);
+    if (idx == -1) {
+        idx = m_funcs.addThread(th);
+        if (idx == -1) {
+            return nullptr;
+        }
+    }
+
+    std::atomic<TimelineBuffer*>& slot = m_timeline.buffers[static_cast<size_t>(idx)];
+    TimelineBuffer* buf = slot.load(std::memory_order_acquire);
+    if (!buf) {
+        buf = new TimelineBuffer();
+        buf->capacity = m_options.timelineMaxEventsPerThread;
+        buf->events.reset(new TimelineEvent[buf->capacity]);
+        slot.store(buf, std::memory_order_release);
+    }
+
+    uint64_t captureId = m_timeline.captureId.load();
+    if (buf->captureId.load(std::memory_order_relaxed) != captureId) {
+        buf->count.store(0, std::memory_order_relaxed);
+        buf->dropped.store(0, std::memory_order_relaxed);
+        buf->captureId.store(captureId, std::memory_order_release);
+    }
+
+    return buf;
+}
+
+void Profiler::addTimelineEvent(const std::string& func, int64_t beginNs)
+{
+    int64_t endNs = timelineTime();
+
+    TimelineBuffer* buf = timelineBuffer();
+    if (!buf) {
+        return;
+    }
+
+    size_t count = buf->count.load(std::memory_order_relaxed);
+    if (count >= buf->capacity) {
+        buf->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buf->events[count] = { &func, beginNs, endNs - beginNs };
+    buf->count.store(count + 1, std::memory_order_release);
+}
+
+static void appendMicroseconds(std::string& str, int64_t ns)
+{
+    if (ns < 0) {
+        ns = 0;
+    }
+
+    std::string frac = std::to_string(ns % 1000);
+    str.append(std::to_string(ns / 1000)).append(1, '.').append(3 - frac.size(), '0').append(frac);
+}
+
+static void appendEscaped(std::string& str, const std::string& val)
+{
+    for (char c : val) {
+        switch (c) {
+        case '"':
+            str.append("\\\"");
+            break;
+        case '\\':
+            str.append("\\\\");
+            break;
+        case '\n':
+            str.append("\\n");
+            break;
+        case '\t':
+            str.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                str.append(1, ' ');
+            } else {
+                str.append(1, c);
+            }
+        }
+    }
+}
+
+std::string Profiler::timelineJson() const
+{
+    std::lock_guard<std::mutex> lock(m_steps.mutex);
+
+    const uint64_t captureId = m_timeline.captureId.load();
+    const int64_t beginNs = m_timeline.beginNs;
+    size_t dropped = 0;
+
+    std::string json;
+    json.append("{\"traceEvents\":[");
+
+    bool isFirst = true;
+    auto beginEvent = [&json, &isFirst](const std::string& ph, const std::string& tid) {
+        json.append(isFirst ? "\n" : ",\n");
+        isFirst = false;
+        json.append("{\"ph\":\"").append(ph).append("\",\"pid\":1,\"tid\":").append(tid);
+    };
+
+    for (size_t i = 0; i < m_timeline.buffers.size(); ++i) {
+        const TimelineBuffer* buf = m_timeline.buffers[i].load(std::memory_order_acquire);
+        if (!buf || buf->captureId.load(std::memory_order_acquire) != captureId) {
+            continue;
+        }
+
+        const size_t count = buf->count.load(std::memory_order_acquire);
+        dropped += buf->dropped.load(std::memory_order_relaxed);
+
+        const std::string tid = std::to_string(i);
+        beginEvent("M", tid);
+        json.append(",\"name\":\"thread_name\",\"args\":{\"name\":\"")
+        .append(i == MAIN_THREAD_INDEX ? std::string("main") : "thread " + tid)
+        .append("\"}}");
+
+        json.reserve(json.size() + count * 100);
+        for (size_t e = 0; e < count; ++e) {
+            const TimelineEvent& ev = buf->events[e];
+            if (ev.beginNs < beginNs) { //! NOTE Begun before the capture
+                continue;
+            }
+
+            beginEvent("X", tid);
+            json.append(",\"ts\":");
+            appendMicroseconds(json, ev.beginNs - beginNs);
+            json.append(",\"dur\":");
+            appendMicroseconds(json, ev.durationNs);
+            json.append(",\"name\":\"");
+            appendEscaped(json, *ev.name);
+            json.append("\"}");
+        }
+    }
+
+    for (const TimelineInstant& in : m_timeline.instants) {
+        beginEvent("i", std::to_string(in.thread));
+        json.append(",\"s\":\"t\",\"ts\":");
+        appendMicroseconds(json, in.timeNs - beginNs);
+        json.append(",\"name\":\"");
+        appendEscaped(json, in.name);
+        json.append("\"}");
+    }
+
+    json.append("\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":\"")
+    .append(std::to_string(dropped))
+    .append("\"}}\n");
+
+    return json;
+}
+
+bool Profiler::saveTimeline(const std::string& filePath)
+{
+    std::string content = timelineJson();
+    bool ok = save_file(filePath, content);
+    return ok;
+}
+
 bool Profiler::save_file(const std::string& path, const std::string& content)
 {
     FILE* pFile = fopen(path.c_str(), "w");
@@ -3,6 +3,9 @@
 
 #include <string>
 #include <list>
+#include <memory>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <set>
 #include <unordered_map>
@@ -55,6 +58,14 @@
 #define PROFILER_PRINT haw::profiler::Profiler::instance()->printThreadsData();
 #endif
 
+#ifndef PROFILER_TIMELINE_START
+#define PROFILER_TIMELINE_START haw::profiler::Profiler::instance()->startTimeline();
+#endif
+
+#ifndef PROFILER_TIMELINE_STOP
+#define PROFILER_TIMELINE_STOP haw::profiler::Profiler::instance()->stopTimeline();
+#endif
+
 #else
 
 #define TRACEFUNC
@@ -63,6 +74,8 @@
 #define STEP_TIME
 #define PROFILER_CLEAR
 #define PROFILER_PRINT
+#define PROFILER_TIMELINE_START
+#define PROFILER_TIMELINE_STOP
 
 #endif
 
@@ -79,6 +92,7 @@ public:
         bool funcsTraceEnabled{ false };
         size_t funcsMaxThreadCount{ 100 };
         int dataTopCount{ 150 };
+        size_t timelineMaxEventsPerThread{ 200000 }; //! NOTE 24 bytes per event
         Options() {}
     };
 
@@ -162,6 +176,15 @@ public:
 
     bool save(const std::string& filePath);
 
+    //! NOTE Timeline: every call of the marked functions with its begin time, duration and thread,
+    //! saved in the Chrome trace event format (open with chrome://tracing or https://ui.perfetto.dev)
+    void startTimeline();
+    void stopTimeline();
+    static bool isTimelineActive();
+
+    std::string timelineJson() const; //! NOTE Call after stopTimeline
+    bool saveTimeline(const std::string& filePath);
+
 private:
     Profiler();
     ~Profiler();
@@ -183,7 +206,7 @@ private:
 
     typedef std::unordered_map<std::string, StepTimer* > StepTimers;
     struct StepsData {
-        std::mutex mutex;
+        mutable std::mutex mutex;
         StepTimers timers;
     };
 
@@ -198,12 +221,50 @@ private:
         int addThread(std::thread::id th);
     };
 
+    //! NOTE Each thread writes only to the buffer of its own slot, so no locks are needed.
+    //! A buffer is allocated on the first event of a thread and is reused by the next captures,
+    //! events above the limit are dropped.
+    struct TimelineEvent {
+        const std::string* name;
+        int64_t beginNs;
+        int64_t durationNs;
+    };
+
+    struct TimelineBuffer {
+        std::unique_ptr<TimelineEvent[]> events;
+        size_t capacity{ 0 };
+        std::atomic<size_t> count{ 0 };
+        std::atomic<size_t> dropped{ 0 };
+        std::atomic<uint64_t> captureId{ 0 };
+    };
+
+    struct TimelineInstant {
+        std::string name;
+        int64_t timeNs;
+        int thread;
+    };
+
+    struct TimelineData {
+        std::vector<std::atomic<TimelineBuffer*> > buffers;
+        std::atomic<uint64_t> captureId{ 0 };
+        int64_t beginNs{ 0 };
+        int64_t endNs{ 0 };
+        std::vector<TimelineInstant> instants; //! NOTE Under StepsData::mutex
+    };
+
+    static int64_t timelineTime();
+    void addTimelineEvent(const std::string& func, int64_t beginNs);
+    TimelineBuffer* timelineBuffer();
+
     bool save_file(const std::string& path, const std::string& content);
 
+    static std::atomic<bool> m_timelineActive;
+
     Printer* m_printer{ nullptr };
 
     StepsData m_steps;
     FuncsData m_funcs;
+    TimelineData m_timeline;
 
     size_t m_stackCounter{ 0 };
 };
@@ -216,6 +277,10 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             timer = Profiler::instance()->beginFunc(fn);
         }
+
+        if (Profiler::isTimelineActive()) {
+            timelineBeginNs = Profiler::timelineTime();
+        }
     }
 
     ~FuncMarker()
@@ -223,12 +288,17 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             Profiler::instance()->endFunc(timer, func);
         }
+
+        if (timelineBeginNs >= 0 && Profiler::isTimelineActive()) {
+            Profiler::instance()->addTimelineEvent(func, timelineBeginNs);
+        }
     }
 
     static std::string formatSig(const std::string& sig);
 
     Profiler::FuncTimer* timer{ nullptr };
     const std::string& func;
+    int64_t timelineBeginNs{ -1 };
 };
 }
 
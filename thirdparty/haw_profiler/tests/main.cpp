@@ -75,10 +75,16 @@ int main(int argc, char* argv[])
     std::clog << "Hello World, I am Profiler\n";
 
     Example t;
+
+    PROFILER_TIMELINE_START;
     t.example();
+    PROFILER_TIMELINE_STOP;
 
     PROFILER_PRINT;
 
+    //! NOTE Open with chrome://tracing or https://ui.perfetto.dev
+    haw::profiler::Profiler::instance()->saveTimeline("haw_profiler_timeline.json");
+
     /* Output:
         mark1 : 0.000/0.000 ms: Begin
         mark1 : 21.582/21.545 ms: end call func2 10 times